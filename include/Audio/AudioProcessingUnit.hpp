@@ -25,10 +25,16 @@ namespace ggb
 	public:
 		AudioProcessingUnit(BUS* bus);
 		void setBus(BUS* bus);
-		// Returns true if the write was handled, false if a raw memory write should be made
+		// Returns true if the write was handled, false if a raw memory write should be made.
+		// Only for the registers that don't belong to a channel, the channel registers are accessed with writeChannel / readChannel
 		bool write(uint16_t address, uint8_t value);
 		std::optional<uint8_t> read(uint16_t address) const;
+		bool writeChannel(size_t channelID, uint16_t address, uint8_t value);
+		std::optional<uint8_t> readChannel(size_t channelID, uint16_t address) const;
+		std::optional<size_t> getChannelID(uint16_t address) const; // The channel the register belongs to
 		void step(int cyclesPassed);
+		// Every step with fewer cycles only advances counters, the next sample / frame sequencer tick / channel tick happens after it
+		int cyclesUntilNextEvent() const;
 		SampleBuffer* getSampleBuffer();
 		void serialization(Serialization* serialization);
 		void reset();
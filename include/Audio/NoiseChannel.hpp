@@ -13,6 +13,7 @@ namespace ggb
 	public:
 		NoiseChannel(BUS* bus);
 		void step(int cyclesPassed);
+		int cyclesUntilNextEvent() const;
 		void setBus(BUS* bus) override;
 		bool write(uint16_t address, uint8_t value) override;
 		std::optional<uint8_t> read(uint16_t address) const override;
@@ -30,6 +31,7 @@ namespace ggb
 		void trigger();
 		bool isLengthShutdownEnabled() const;
 		bool isLFSR7Bit() const;
+		int getLFSRTimer() const; // In CPU cycles
 		int getClockShift() const;
 		int getClockDivider() const;
 		void resetLFSR();
@@ -30,6 +30,7 @@ namespace ggb
 	public:
 		SquareWaveChannel(bool hasSweep, BUS* bus);
 		void step(int cyclesPassed);
+		int cyclesUntilNextEvent() const;
 		void setBus(BUS* bus) override;
 		bool write(uint16_t memory, uint8_t value) override;
 		std::optional<uint8_t> read(uint16_t address) const override;
@@ -14,6 +14,7 @@ namespace ggb
 	public:
 		WaveChannel(BUS* bus);
 		void step(int cyclesPassed);
+		int cyclesUntilNextEvent() const;
 		void setBus(BUS* bus) override;
 		bool write(uint16_t address, uint8_t value) override;
 		std::optional<uint8_t> read(uint16_t address) const override;
@@ -1,4 +1,5 @@
 #pragma once
+#include <cassert>
 #include <cstdint>
 #include <array>
 
@@ -12,6 +13,7 @@ namespace ggb
 	class AudioProcessingUnit;
 	class PixelProcessingUnit;
 	class Input;
+	class Scheduler;
 
 	struct HBlankDMA
 	{
@@ -21,16 +23,47 @@ namespace ggb
 		uint16_t index = 0;
 	};
 
+	// All the memory of the BUS that isn't part of the cartridge, in one fixed size block.
+	// Only 0xFE00 - 0xFFFF (OAM, IO registers, HRAM) is stored at its address, VRAM and WRAM are stored per bank
+	struct alignas(64) MemoryArena
+	{
+		static constexpr uint16_t HIGH_MEMORY_START_ADDRESS = OAM_ADDRESS;
+		static constexpr size_t HIGH_MEMORY_SIZE = 0xFFFF - HIGH_MEMORY_START_ADDRESS + 1;
+
+		// Only for addresses from 0xFE00 on
+		uint8_t& operator[](uint16_t address)
+		{
+			assert(address >= HIGH_MEMORY_START_ADDRESS);
+			return highMemory[address - HIGH_MEMORY_START_ADDRESS];
+		}
+		const uint8_t& operator[](uint16_t address) const
+		{
+			assert(address >= HIGH_MEMORY_START_ADDRESS);
+			return highMemory[address - HIGH_MEMORY_START_ADDRESS];
+		}
+
+		std::array<std::array<uint8_t, VRAM_BANK_MEMORY_SIZE>, GBC_VRAM_BANK_COUNT> vram = {};
+		std::array<std::array<uint8_t, WRAM_BANK_MEMORY_SIZE>, GBC_WRAM_BANK_COUNT> wram = {};
+		std::array<uint8_t, HIGH_MEMORY_SIZE> highMemory = {};
+	};
+
 	class BUS
 	{
 	public:
-		BUS() = default;
+		BUS();
+		BUS(const BUS&) = delete; // The memory pages point into the own memory
+		BUS& operator=(const BUS&) = delete;
 		void reset();
 		void setCartridge(Cartridge* cartridge);
+		// Maps the pages of the cartridge ROM / RAM to the selected banks, has to be called after the cartridge memory changed (e.g. loaded RAM)
+		void updateCartridgeMemoryPages();
 		void setTimer(Timer* cartridge);
 		void setAudio(AudioProcessingUnit* audio);
 		void setPixelProcessingUnit(PixelProcessingUnit* ppu);
 		void setInput(Input* input);
+		void setScheduler(Scheduler* scheduler);
+		// Assigns the read / write handler of every IO register, has to be called after the components are set
+		void buildIORegisterTable();
 		uint8_t read(uint16_t address) const;
 		int8_t readSigned(uint16_t address) const;
 		void write(uint16_t address, uint8_t value);
@@ -42,29 +75,74 @@ namespace ggb
 		void serialization(Serialization* serialization); // Used for both serialize / deserialize
 		void handleHBlank();
 		bool isGBCDoubleSpeedOn() const;
+		int getROMBankNumber() const; // The cartridge ROM bank currently mapped into 0x4000 - 0x7FFF
 		/// Returns if the current BUS object is valid and can be used
 		bool valid() const;
 
 	private:
+		static constexpr size_t MEMORY_PAGE_COUNT = 0x100; // One page per 256 bytes, indexed by the upper byte of the address
+		static constexpr size_t IO_REGISTER_COUNT = IO_REGISTERS_END_ADDRESS - IO_REGISTERS_START_ADDRESS + 1;
+
+		struct IORegister
+		{
+			uint8_t(*read)(const BUS* bus, uint16_t address) = nullptr;
+			void(*write)(BUS* bus, uint16_t address, uint8_t value) = nullptr;
+		};
+
+		// Maps the pages of VRAM, WRAM and echo RAM to the currently selected banks, has to be called after bank switches
+		void updateMemoryPages();
+		// IO register handlers, the Timer / PPU / APU is synchronized before its registers are accessed and rescheduled after writes
+		static uint8_t readMemory(const BUS* bus, uint16_t address);
+		static uint8_t readWriteOnly(const BUS* bus, uint16_t address);
+		static uint8_t readTimerCounter(const BUS* bus, uint16_t address);
+		static uint8_t readAudio(const BUS* bus, uint16_t address);
+		template <size_t ChannelID>
+		static uint8_t readAudioChannel(const BUS* bus, uint16_t address);
+		static uint8_t readVRAMBank(const BUS* bus, uint16_t address);
+		static uint8_t readColorPaletteData(const BUS* bus, uint16_t address);
+		static void writeMemory(BUS* bus, uint16_t address, uint8_t value);
+		static void writeInput(BUS* bus, uint16_t address, uint8_t value);
+		static void writeTimerDivider(BUS* bus, uint16_t address, uint8_t value);
+		static void writeTimerRegister(BUS* bus, uint16_t address, uint8_t value);
+		static void writeTimerControl(BUS* bus, uint16_t address, uint8_t value);
+		static void writeAudio(BUS* bus, uint16_t address, uint8_t value);
+		template <size_t ChannelID>
+		static void writeAudioChannel(BUS* bus, uint16_t address, uint8_t value);
+		static void writeLCDControl(BUS* bus, uint16_t address, uint8_t value);
+		static void writeLCDStatus(BUS* bus, uint16_t address, uint8_t value);
+		static void writeDirectMemoryAccess(BUS* bus, uint16_t address, uint8_t value);
+		static void writeDMGPalette(BUS* bus, uint16_t address, uint8_t value);
+		static void writeSpeedSwitch(BUS* bus, uint16_t address, uint8_t value);
+		static void writeBankSelection(BUS* bus, uint16_t address, uint8_t value);
+		static void writeGBCVRAMDirectMemoryAccess(BUS* bus, uint16_t address, uint8_t value);
+		static void writeColorPaletteData(BUS* bus, uint16_t address, uint8_t value);
 		void toggleGBCDoubleSpeed();
 		void updateGBCDoubleSpeed();
 		void directMemoryAccess(uint8_t value);
 		void directMemoryAccess(uint16_t sourceAddress, uint16_t destinationAddress, uint16_t sizeInBytes);
+		// Memory that can be copied without going through read / write (ROM, VRAM, WRAM, OAM...), nullptr otherwise.
+		// The span must not cross a page
+		const uint8_t* getDirectMemoryAccessSource(uint16_t address) const;
+		uint8_t* getDirectMemoryAccessDestination(uint16_t address, uint16_t sizeInBytes);
 		void gbcVRAMDirectMemoryAccess();
 		int getActiveVRAMBank() const;
 		int getWRAMBank(uint16_t address) const;
-		uint16_t getWRAMAddress(uint16_t address) const;
 
 		Cartridge* m_cartridge = nullptr;
 		Timer* m_timer = nullptr;
 		AudioProcessingUnit* m_audio = nullptr;
 		PixelProcessingUnit* m_ppu = nullptr;
 		Input* m_input = nullptr;
-		std::vector<uint8_t> m_memory = std::vector<uint8_t>(0xFFFF + 1, 0);
-		std::array<std::array<uint8_t, WRAM_BANK_MEMORY_SIZE>, GBC_WRAM_BANK_COUNT> m_wram = {};
-		std::array<std::array<uint8_t, VRAM_BANK_MEMORY_SIZE>, GBC_VRAM_BANK_COUNT> m_vram = {};
+		Scheduler* m_scheduler = nullptr;
+		MemoryArena m_memory = {};
 		HBlankDMA m_hBlankDMA = {};
+		// Pages backed directly by memory, reads and writes of the other pages (nullptr) go through the cartridge / IO handling
+		std::array<const uint8_t*, MEMORY_PAGE_COUNT> m_readPages = {};
+		std::array<uint8_t*, MEMORY_PAGE_COUNT> m_writePages = {};
+		std::array<IORegister, IO_REGISTER_COUNT> m_ioRegisters = {};
 		bool m_doubleSpeedOn = false;
+		bool m_validMemory = true; // False if a deserialized state had a different memory layout
+		int m_romBankNumber = 1; // Only changes on writes into the cartridge ROM area
 	};
 	int getVRAMIndexFromAddress(uint16_t address);
 }
\ No newline at end of file
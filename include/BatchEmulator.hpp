@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Emulator.hpp"
+
+namespace ggb
+{
+	// Called after every frame of an environment, from the thread that runs it (so it must not modify shared state)
+	using RewardFunction = std::function<float(const Emulator& emulator, size_t environment)>;
+	using DoneFunction = std::function<bool(const Emulator& emulator, size_t environment)>;
+
+	// Contiguous buffers of the caller, with one entry per environment
+	struct BatchBuffers
+	{
+		uint8_t* observations = nullptr; // getObservationSize() bytes per environment
+		float* rewards = nullptr; // Summed over the frames of one step
+		uint8_t* done = nullptr; // 1 if the done function returned true, the environment is not stepped any further
+	};
+
+	// Owns a number of emulators (environments) running the same cartridge and steps all of them in parallel,
+	// e.g. for reinforcement learning. The environments are distributed dynamically over a fixed set of threads
+	class BatchEmulator
+	{
+	public:
+		// threadCount includes the calling thread
+		BatchEmulator(size_t environmentCount, const ObservationSettings& observation, size_t threadCount = std::thread::hardware_concurrency());
+		~BatchEmulator();
+		BatchEmulator(const BatchEmulator&) = delete;
+		BatchEmulator& operator=(const BatchEmulator&) = delete;
+
+		bool loadCartridge(const std::filesystem::path& path);
+		void setRewardFunction(RewardFunction rewardFunction);
+		void setDoneFunction(DoneFunction doneFunction);
+		// Sets the input of every environment (actions[environment]), runs all of them for frameCount frames
+		// and writes the observations of the last frames, the rewards and the done flags into the buffers
+		void step(const GameboyInput* actions, int frameCount, const BatchBuffers& buffers);
+		void reset(size_t environment); // E.g. after it is done
+		size_t size() const;
+		size_t getObservationSize() const; // In bytes
+		Emulator& getEnvironment(size_t environment);
+
+	private:
+		// Runs task(environment) for every environment and returns after all of them are finished
+		void runParallel(const std::function<void(size_t)>& task);
+		void runTasks();
+		void workerLoop();
+
+		std::vector<std::unique_ptr<Emulator>> m_environments;
+		RewardFunction m_rewardFunction;
+		DoneFunction m_doneFunction;
+		std::vector<uint8_t> m_done; // Not a vector<bool>, the environments are written from different threads
+
+		std::vector<std::thread> m_workers;
+		std::mutex m_mutex;
+		std::condition_variable m_workAvailable;
+		std::condition_variable m_workFinished;
+		const std::function<void(size_t)>* m_task = nullptr;
+		std::atomic<size_t> m_nextEnvironment = 0;
+		std::atomic<size_t> m_remainingTasks = 0;
+		uint64_t m_generation = 0;
+		bool m_stop = false;
+	};
+}
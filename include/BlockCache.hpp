@@ -0,0 +1,47 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "BUS.hpp"
+#include "CPUInstructions.hpp"
+
+namespace ggb
+{
+	// Caches straight-line runs of predecoded instructions from the cartridge ROM, keyed by (ROM bank, address)
+	class BlockCache
+	{
+	public:
+		static constexpr int MAX_BLOCK_LENGTH = 16;
+
+		struct MicroOp
+		{
+			InstructionFunction func = nullptr;
+			uint16_t operand = 0;
+			uint8_t length = 0; // In bytes, including the opcode (and the CB prefix)
+		};
+
+		struct Block
+		{
+			uint16_t address = 0;
+			int bank = -1; // -1 = unused entry, always 0 for blocks in the fixed bank
+			int size = 0;
+			std::array<MicroOp, MAX_BLOCK_LENGTH> microOps = {};
+		};
+
+		void clear();
+		// Returns the block starting at the given address and decodes it on a cache miss, 
+		// returns nullptr if the address is not cacheable or no instruction could be decoded
+		const Block* getBlock(uint16_t address, int romBank, const BUS* bus);
+		// Returns if the block was decoded from another ROM bank than the one currently mapped
+		static bool isStale(const Block& block, int romBank);
+		static bool isCacheableAddress(uint16_t address);
+
+	private:
+		static int getBankKey(uint16_t address, int romBank);
+		static void decode(Block* block, const BUS* bus);
+
+		static constexpr int BLOCK_COUNT = 1024;
+		std::vector<Block> m_blocks = std::vector<Block>(BLOCK_COUNT);
+	};
+}
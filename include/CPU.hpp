@@ -3,6 +3,9 @@
 #include "BUS.hpp"
 #include "CPUState.hpp"
 #include "CPUInstructions.hpp"
+#include "BlockCache.hpp"
+#include "IdleLoopDetector.hpp"
+#include "Scheduler.hpp"
 
 namespace ggb
 {
@@ -11,17 +14,34 @@ namespace ggb
 	public:
 		void reset();
 		void setBus(BUS* bus);
-		int step();
+		void setScheduler(Scheduler* scheduler);
+		// endCycle is the end of the current run, the threaded interpreter may execute several instructions up to it
+		int step(uint64_t endCycle);
+		// Cycles of one iteration if the last step jumped back to the start of an idle loop or the cpu is halted, 0 otherwise.
+		// Until the next interrupt or change of the polled memory every further step repeats the last iteration
+		int getIdleLoopCycles() const;
+		void setIdleLoopDetection(bool enabled);
 		void serialization(Serialization* serialization); // Used for both serialize / deserialize
 		const CPUState* getCPUState() const;
 
 	private:
 		bool handleInterrupts();
+		int executeNextInstruction(uint64_t endCycle);
+		// Returns the predecoded instruction at the instruction pointer, nullptr if it is not in the block cache
+		const BlockCache::MicroOp* nextCachedMicroOp();
+		void invalidateBlockCache();
+		void detectIdleLoop(uint16_t instructionAddress);
 
 		BUS* m_bus = nullptr;
-		OPCodes m_opcodes; // TODO maybe not make this part of cpu but instead a static variable
+		Scheduler* m_scheduler = nullptr;
+		BlockCache m_blockCache;
+		const BlockCache::Block* m_currentBlock = nullptr;
+		int m_currentMicroOp = 0;
+		uint16_t m_nextInstructionPointer = 0;
 		CPUState m_cpuState;
 		uint8_t* m_requestedInterrupts = nullptr;
 		const uint8_t* m_enabledInterrupts = nullptr;
+		bool m_idleLoopDetection = true;
+		int m_idleLoopCycles = 0;
 	};
 }
\ No newline at end of file
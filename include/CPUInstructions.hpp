@@ -1,14 +1,18 @@
 #pragma once
-#include <vector>
+#include <string_view>
 
 #include "CPUState.hpp"
 #include "BUS.hpp"
 
 namespace ggb
 {
-#define CPUInstructionParameters CPUState* cpu, BUS* bus, bool* branchTaken
+	class Scheduler;
+
+#define CPUInstructionParameters CPUState* cpu, BUS* bus, uint16_t operand
 	// It is possible to use std::function here, however debugging is easier with plain C function pointers (and no performance overhead)
-	using InstructionFunction = void (*)(CPUInstructionParameters);
+	// operand is the already fetched immediate value of the instruction (0 if it has none)
+	// Returns the number of cycles the instruction took (including a taken branch)
+	using InstructionFunction = int (*)(CPUInstructionParameters);
 
 	void callAddress(CPUState* cpu, BUS* bus, uint16_t address);
 
@@ -20,20 +24,19 @@ namespace ggb
 			int id = -1;
 			InstructionFunction func = nullptr;
 			int baseCycleCount = 0;
-			std::string mnemonic;
+			std::string_view mnemonic;
 			int branchCycleCount = 0;
+			int length = 1; // In bytes, including the opcode
 		};
-		OPCodes();
-		int execute(uint16_t opCode, ggb::CPUState* cpu, ggb::BUS* bus) const;
-		const std::string& getMnemonic(uint16_t opCode) const;
-	private:
-		void setOpcode(OPCode&& opcode);
-		void setExtendedOpcode(OPCode&& opcode);
-		void initOpcodesArray();
-
-		std::vector<OPCode> m_opcodes;
-		std::vector<OPCode> m_extendedOpcodes;
-		int m_counter = 0;
-		int m_extendedOpcodeCounter = 0;
+		// The tables are generated at compile time, the class itself has no state
+		static int execute(uint16_t opCode, ggb::CPUState* cpu, ggb::BUS* bus);
+		// Fetches and executes instructions with threaded dispatch (computed goto if supported, switch otherwise)
+		// until the next deadline of the scheduler or endCycle is reached, the cpu is stopped or an enabled interrupt is pending.
+		// Executes at least one instruction. The scheduler is advanced before every further instruction (register accesses
+		// synchronize the components up to the current cycle), the cycles of the last instruction are returned instead.
+		static int executeThreaded(CPUState* cpu, BUS* bus, Scheduler* scheduler, uint64_t endCycle, const uint8_t* requestedInterrupts, const uint8_t* enabledInterrupts);
+		static std::string_view getMnemonic(uint16_t opCode);
+		static const OPCode& getOpcode(uint8_t opCode);
+		static const OPCode& getExtendedOpcode(uint8_t opCode);
 	};
 }
\ No newline at end of file
@@ -8,6 +8,22 @@ namespace ggb
 	class CPUState
 	{
 	public:
+		// The last flag changing operation, the flags are only computed from it when they are read
+		enum class FlagOperation : uint8_t
+		{
+			NONE, // F is up to date
+			ADD, // 8 bit ADD / ADC
+			SUBTRACT, // SUB / SBC / CP
+			INCREMENT,
+			DECREMENT,
+			ADD_16_BIT,
+			AND,
+			OR, // Also XOR and SWAP
+			BIT,
+			ROTATE_A, // RLCA, RLA, RRCA, RRA (zero flag is always reset)
+			SHIFT, // Rotates and shifts of the extended opcodes
+		};
+
 		// 8 Bit registers
 		uint8_t& A();
 		uint8_t& F();
@@ -34,6 +50,9 @@ namespace ggb
 		bool getHalfCarryFlag() const;
 		void setCarryFlag(bool value);
 		bool getCarryFlag() const;
+		// Records the operation instead of setting the flags, carry is the carry in (ADC / SBC) or the carry out of rotations and shifts
+		void setFlagsFromOperation(FlagOperation operation, uint16_t operand, uint16_t operand2, uint32_t result, uint8_t carry = 0);
+		void materializeFlags();
 		void disableInterrupts();
 		void enableInterrupts();
 		bool interruptsEnabled() const;
@@ -43,6 +62,16 @@ namespace ggb
 		void serialization(Serialization* serialization); // Used for both serialize / deserialize
 
 	private:
+		struct LazyFlags
+		{
+			FlagOperation operation = FlagOperation::NONE;
+			uint8_t carry = 0;
+			bool zero = false; // The preserved zero flag of 16 bit additions
+			uint16_t operand = 0;
+			uint16_t operand2 = 0;
+			uint32_t result = 0;
+		};
+
 		uint8_t F() const;
 
 		union { uint16_t AF; uint8_t regs[2]; } afUnion = {};
@@ -53,6 +82,7 @@ namespace ggb
 		uint16_t m_instructionPointer = 0;
 		bool m_interruptsEnabled = true;
 		bool m_stopped = false;
+		LazyFlags m_lazyFlags = {};
 	};
 
 	void increment(CPUState* cpu, uint8_t& toIncrement);
@@ -14,6 +14,8 @@ namespace ggb
 		bool load(const std::filesystem::path& romPath);
 		void write(uint16_t address, uint8_t value);
 		uint8_t read(uint16_t address) const;
+		int getROMBankNumber() const;
+		const MappedBanks& getMappedBanks() const;
 		void serialize(Serialization* serialize);
 		void deserialize(Serialization* deserialize);
 		void saveRAM(const std::filesystem::path& outputPath);
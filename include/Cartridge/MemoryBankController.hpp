@@ -31,12 +31,23 @@ namespace ggb
 	int convertRawAddressToRAMBankAddress(uint16_t address, int ramBankNumber);
 	MBCTYPE getMBCType(const std::vector<uint8_t>& cartRidgeData);
 
+	// Memory of the currently selected banks that can be accessed without the MBC,
+	// nullptr if the accesses have to go through read / write (e.g. disabled RAM)
+	struct MappedBanks
+	{
+		const uint8_t* fixedROMBank = nullptr; // 0x0000 - 0x3FFF
+		const uint8_t* switchableROMBank = nullptr; // 0x4000 - 0x7FFF
+		const uint8_t* readableRAMBank = nullptr; // 0xA000 - 0xBFFF
+		uint8_t* writableRAMBank = nullptr; // 0xA000 - 0xBFFF
+	};
+
 	class MemoryBankController // Often abbreviated as MBC
 	{
 	public:
 		virtual ~MemoryBankController() = default;
 		virtual void write(uint16_t address, uint8_t value) = 0;
 		virtual uint8_t read(uint16_t address) const = 0;
+		virtual int getROMBankNumber() const; // The bank currently mapped into 0x4000 - 0x7FFF
 		MBCTYPE getMBCType() const;
 		int getRomSize() const;
 		int getROMBankCount() const;
@@ -50,8 +61,15 @@ namespace ggb
 		virtual void initialize(std::vector<uint8_t>&& cartridgeData);
 		virtual void serialization(Serialization* serialization);
 		static bool shouldEnableRAM(uint8_t value);
+		// Has to be called after the selected banks or the cartridge memory changed
+		virtual void updateMappedBanks();
+		const MappedBanks& getMappedBanks() const;
 
 	protected:
+		const uint8_t* getROMBank(int bank) const; // nullptr if the bank is outside of the cartridge data
+		uint8_t* getRAMBank(int bank); // nullptr if the bank is outside of the RAM
+
+		MappedBanks m_mappedBanks = {};
 		std::vector<uint8_t> m_cartridgeData;
 		std::vector<uint8_t> m_ram;
 		bool m_hasRam = false;
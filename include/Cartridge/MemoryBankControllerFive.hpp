@@ -9,8 +9,10 @@ namespace ggb
 	public:
 		void write(uint16_t address, uint8_t value) override;
 		uint8_t read(uint16_t address) const override;
+		int getROMBankNumber() const override;
 		void initialize(std::vector<uint8_t>&& cartridgeData) override;
 		virtual void serialization(Serialization* serialization) override;
+		void updateMappedBanks() override;
 
 	private:
 		void setROMBank();
@@ -9,10 +9,12 @@ namespace ggb
 	public:
 		virtual void write(uint16_t address, uint8_t value) override;
 		virtual uint8_t read(uint16_t address) const override;
+		int getROMBankNumber() const override;
 		void initialize(std::vector<uint8_t>&& cartridgeData) override;
 		virtual void serialization(Serialization* serialization) override;
 		virtual void saveRTC(const std::filesystem::path& path) override;
 		virtual void loadRTC(const std::filesystem::path& path) override;
+		void updateMappedBanks() override;
 
 	private:
 		void setROMBank(uint8_t value);
@@ -100,10 +100,15 @@ namespace ggb
 	constexpr uint16_t GBC_OBJECT_COLOR_PALETTE_DATA_ADDRESS = 0xFF6B;
 	constexpr uint16_t GBC_OBJECT_PRIORITY_MODE_ADDRESS = 0xFF6C;
 	constexpr uint16_t GBC_WRAM_BANKING_ADDRESS = 0xFF70;
+	constexpr uint16_t IO_REGISTERS_START_ADDRESS = INPUT_REGISTER_ADDRESS;
+	constexpr uint16_t IO_REGISTERS_END_ADDRESS = 0xFF7F;
+	constexpr uint16_t HRAM_START_ADDRESS = 0xFF80;
+	constexpr uint16_t HRAM_END_ADDRESS = 0xFFFE;
 	constexpr uint16_t ENABLED_INTERRUPT_ADDRESS = 0xFFFF;
 
 
 	constexpr uint32_t CPU_BASE_CLOCK = 4194304; // frequency in hz
+	constexpr int CPU_CYCLES_PER_FRAME = 70224; // 154 scanlines with 456 cycles each, twice as many in GBC double speed mode
 	constexpr uint32_t PERIOD_DIVIDER_CLOCK = 1048576; // frequency in hz
 	constexpr double NANO_SECONDS_PER_CYCLE = 1000000000.0 / CPU_BASE_CLOCK;
 	constexpr uint32_t STANDARD_SAMPLE_RATE = 44100; // In hertz
@@ -119,6 +124,7 @@ namespace ggb
 	constexpr uint16_t OBJECT_MEMORY_SIZE = 4; // in bytes
 	constexpr uint16_t MAX_ALLOWED_OBJS_PER_SCANLINE = 40;
 	constexpr uint16_t TILE_MEMORY_SIZE = 16; // in bytes
+	constexpr uint16_t VRAM_TILE_COUNT = 384; // Per VRAM bank (0x8000 - 0x97FF)
 	constexpr uint16_t TILE_WIDTH = 8; // in pixel
 	constexpr uint16_t TILE_HEIGHT = 8; // in pixel
 	constexpr uint16_t TILE_MAP_WIDTH = 32;
@@ -130,6 +136,7 @@ namespace ggb
 	constexpr uint16_t GBC_WRAM_BANK_COUNT = 8;
 	constexpr uint16_t GBC_COLOR_RAM_MEMORY_SIZE = 64; // in bytes
 	constexpr uint16_t GBC_COLOR_PALETTE_COUNT = 8;
+	constexpr int NO_PENDING_EVENT = 0x7FFFFFFF; // cyclesUntilNextEvent of a component that has nothing scheduled
 	using AUDIO_FORMAT = int16_t;
 
 	template <uint16_t from, uint16_t to>
@@ -147,6 +154,9 @@ namespace ggb
 	constexpr AddressRange<CARTRIDGE_RAM_START_ADDRESS, CARTRIDGE_RAM_END_ADDRESS> isCartridgeRAMAddress = {};
 	constexpr AddressRange<WRAM_START_ADDRESS, WRAM_END_ADDRESS> isWRAMAddress = {};
 	constexpr AddressRange<ECHO_RAM_START_ADDRESS, ECHO_RAM_END_ADDRESS> isEchoRAMAddress = {};
+	constexpr AddressRange<OAM_ADDRESS, OAM_ADDRESS + OAM_MEMORY_SIZE - 1> isOAMAddress = {};
 	constexpr AddressRange<UNUSED_MEMORY_START_ADDRESS, UNUSED_MEMORY_END_ADDRESS> isUnusedMemoryAddress = {};
 	constexpr AddressRange<AUDIO_MEMORY_START_ADDRESS, AUDIO_MEMORY_END_ADDRESS> isAudioAddress = {};
+	constexpr AddressRange<IO_REGISTERS_START_ADDRESS, IO_REGISTERS_END_ADDRESS> isIORegisterAddress = {};
+	constexpr AddressRange<HRAM_START_ADDRESS, HRAM_END_ADDRESS> isHRAMAddress = {};
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include <memory>
 #include <filesystem>
+#include <limits>
 
 #include "BUS.hpp"
 #include "CPU.hpp"
@@ -10,11 +11,18 @@
 #include "Audio/AudioProcessingUnit.hpp"
 #include "PixelProcessingUnit.hpp"
 #include "RenderingUtility.hpp"
+#include "Scheduler.hpp"
 #include "Serialization.hpp"
 
 
 namespace ggb
 {
+	struct RunResult
+	{
+		int cycles = 0; // Executed cpu cycles
+		bool frameCompleted = false; // VBlank was entered
+	};
+
 	class Emulator
 	{
 	public:
@@ -23,9 +31,16 @@ namespace ggb
 		void step();
 		// Steps the emulation as fast as possible, does not emulate sound at all
 		void stepAiMode();
+		// Run the emulation in one call instead of calling step / stepAiMode in a loop (same modes).
+		// runCycles returns after the given number of cpu cycles (at most one instruction more),
+		// runFrame at the next VBlank or after the cycles of one frame if the LCD is turned off
+		RunResult runCycles(int cycles);
+		RunResult runCyclesAiMode(int cycles);
+		RunResult runFrame();
+		RunResult runFrameAiMode();
 		void reset();
 		void setTileDataRenderer(std::unique_ptr<ggb::Renderer> renderer);
-		void setGameRenderer(std::unique_ptr<ggb::Renderer> renderer);
+		bool setGameRenderer(std::unique_ptr<ggb::Renderer> renderer); // False if the pixel format isn't RGB
 		// Not const because "serialization" is called and this method is used for read and write and therefore cannot be const
 		bool saveEmulatorState(const std::filesystem::path& outputPath);
 		bool loadEmulatorState(const std::filesystem::path& filePath);
@@ -49,14 +64,38 @@ namespace ggb
 		bool isPaused() const;
 		void setInputState(const ggb::GameboyInput& input);
 		void setColorCorrectionEnabled(bool enabled);
+		// Renders only every n-th frame (1 = every frame, the default), e.g. for fast forwarding. The emulation itself is not affected
+		void setFrameSkip(int renderEveryNthFrame);
+		// Frames are only rendered with a game renderer or if the frame output is enabled.
+		// getCompletedFrame returns the last completed frame without copying it, e.g. after runFrame
+		void setFrameOutputEnabled(bool enabled);
+		FrameView getCompletedFrame() const;
+		// Hands every completed frame over to another thread (e.g. the render thread) instead of calling a renderer
+		// on the emulation thread. The consumer gets the newest frame with exchange->update() and getReadBuffer()
+		void setFrameExchange(std::shared_ptr<FrameExchange> exchange);
+		// Format of the completed frames and the exchange (RGB by default).
+		// Only RGB is allowed while a game renderer is set, returns false if the format was rejected
+		bool setPixelFormat(PixelFormat format);
+		// Downscaled grayscale / palette index observation (std::nullopt disables it), e.g. 84x84 for training agents.
+		// getObservation returns the one of the last completed frame, e.g. after runFrameAiMode
+		void setObservation(std::optional<ObservationSettings> settings);
+		FrameView getObservation() const;
 		uint8_t readBUS(uint16_t address) const;
 		const CPUState* getCPUState() const;
+		// Skips busy wait loops (e.g. polling LY) up to the next PPU / Timer event, deterministic and enabled by default
+		void setIdleLoopSkipping(bool enabled);
         // True = sleep in the synchronization method when we have enough time, false = busy wait on synchronization
         void setEnergySaving(bool value);
 
 	private:
 		bool loadEmulatorState(Serialization* deserialize);
 		void updateMaxSpeedup(int elapsedCycles);
+		// Runs the cpu up to the next scheduled component event and synchronizes the components, returns the elapsed cpu cycles.
+		// A halted cpu or one spinning in an idle loop is fast forwarded up to the event
+		// Stops at endCycle if the next event comes later
+		int runUntilNextEvent(bool doubleSpeed, bool includeAudio, uint64_t endCycle = std::numeric_limits<uint64_t>::max());
+		template <bool AiMode>
+		RunResult run(int cycles, bool untilFrameCompleted);
 		void rewire();
 		void synchronizeEmulatorMasterClock(int elapsedCycles);
 		void serialization(ggb::Serialization* serialization);
@@ -79,6 +118,7 @@ namespace ggb
 		std::unique_ptr<Timer> m_timer;
 		std::unique_ptr<Input> m_input;
 		std::unique_ptr<AudioProcessingUnit> m_audio;
+		std::unique_ptr<Scheduler> m_scheduler;
 		std::filesystem::path m_loadedCartridgePath;
 	};
 }
\ No newline at end of file
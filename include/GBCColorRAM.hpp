@@ -18,15 +18,18 @@ namespace ggb
 		uint8_t read() const;
 		void serialization(Serialization* serialization);
 		const ColorPalette& getColorPalette(size_t index) const;
-		void updateColorPalettes();
+		void setColorCorrectionEnabled(bool enabled);
 
 	private:
 		size_t getRAMAddress() const;
 		void incrementAddress();
+		void updateColor(size_t colorIndex); // Converts the written color, instead of all of them for every scanline
+		void updateColorPalettes();
 
 		uint8_t* m_paletteSpecification = nullptr;
 		const uint16_t m_specificationAddress = 0;
 		std::array<uint8_t, GBC_COLOR_RAM_MEMORY_SIZE> m_colorRAM = {};
 		std::array<ColorPalette, GBC_COLOR_PALETTE_COUNT> m_colorPalettes = {};
+		bool m_colorCorrectionEnabled = false;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+
+#include "BUS.hpp"
+#include "CPUState.hpp"
+
+namespace ggb
+{
+	// Detects busy wait loops, e.g. "LDH A,(LY) / CP n / JR NZ" or polling an interrupt flag in RAM.
+	// The loop body may only load A from memory that changes on component events (LY, STAT, IF, HRAM, WRAM)
+	// and test it (CP, AND, OR, BIT), until the next event every further iteration is an exact repetition.
+	class IdleLoopDetector
+	{
+	public:
+		static constexpr int MAX_LOOP_LENGTH = 16; // In bytes, including the jump
+
+		// Has to be called after the jump at jumpAddress went backwards to the current instruction pointer.
+		// Returns the cycles of one loop iteration if executing the loop again leaves the cpu state unchanged, 0 otherwise
+		static int getIterationCycles(const CPUState& cpuState, BUS* bus, uint16_t jumpAddress);
+
+	private:
+		// Returns the length of the instruction if it is allowed in an idle loop, 0 otherwise
+		static int getLoopBodyInstructionLength(CPUState* cpuState, const BUS* bus, uint16_t address);
+		static bool isJumpTo(const BUS* bus, uint16_t jumpAddress, uint16_t loopStart);
+		static bool isPolledAddress(uint16_t address);
+	};
+}
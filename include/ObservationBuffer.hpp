@@ -0,0 +1,47 @@
+#pragma once
+#include <vector>
+
+#include "Constants.hpp"
+#include "RenderingUtility.hpp"
+
+namespace ggb
+{
+	struct ObservationSettings
+	{
+		int width = 84; // At most the size of the game window
+		int height = 84;
+		// GRAYSCALE8 averages all pixels of the game window that are mapped to the same observation pixel,
+		// PALETTE_INDEX takes the color value of the pixel in the middle of them
+		PixelFormat format = PixelFormat::GRAYSCALE8;
+		bool maxPoolLastTwoFrames = false; // E.g. to see objects that flicker every other frame
+	};
+
+	// Downscales the game window while the scanlines are composed, e.g. as the input of a neural network
+	class ObservationBuffer
+	{
+	public:
+		explicit ObservationBuffer(const ObservationSettings& settings);
+		const ObservationSettings& getSettings() const;
+		// The grayscale or color values (depending on the format) of one line of the game window
+		void writeLine(int y, const uint8_t* line);
+		void completeFrame();
+		// The observation of the last completed frame (width * height bytes)
+		FrameView getView(uint64_t frameNumber, uint64_t cycle) const;
+
+	private:
+		bool isFirstLineOfRow(int y) const;
+		bool isLastLineOfRow(int y) const;
+
+		ObservationSettings m_settings;
+		std::vector<int> m_targetColumns; // Observation column of every column of the game window
+		std::vector<int> m_targetRows; // Observation row of every line of the game window
+		std::vector<int> m_columnPixelCounts;
+		std::vector<int> m_rowPixelCounts;
+		std::vector<int> m_sampleColumns; // Game window column in the middle of every observation column
+		std::vector<int> m_sampleRows;
+		std::vector<uint32_t> m_rowSums;
+		std::vector<uint8_t> m_currentFrame;
+		std::vector<uint8_t> m_previousFrame;
+		std::vector<uint8_t> m_observation;
+	};
+}
@@ -1,14 +1,20 @@
 #pragma once
+#include <array>
 #include <functional>
+#include <optional>
 
 #include "BUS.hpp"
 #include "RenderingUtility.hpp"
 #include "Utility.hpp"
 #include "Serialization.hpp"
 #include "GBCColorRAM.hpp"
+#include "TileCache.hpp"
+#include "ObservationBuffer.hpp"
 
 namespace ggb
 {
+	class Scheduler;
+
 	enum class LCDMode
 	{
 		HBLank = 0,
@@ -85,10 +91,13 @@ namespace ggb
 		PixelProcessingUnit(BUS* bus);
 		void reset();
 		void setBus(BUS* bus);
+		void setScheduler(const Scheduler* scheduler);
 		void step(int elapsedCycles);
+		// Cycles until the next mode transition (all interrupts, rendering and HBlank DMA happen on them)
+		int cyclesUntilNextEvent() const;
 		void setLCDMode(LCDMode mode);
 		void setTileDataRenderer(std::unique_ptr<Renderer> renderer);
-		void setGameRenderer(std::unique_ptr<Renderer> renderer);
+		bool setGameRenderer(std::unique_ptr<Renderer> renderer); // False if the pixel format isn't RGB
 		void setGBCMode(bool value);
 		Dimensions getTileDataDimensions() const;
 		void setDrawTileData(bool enable);
@@ -98,6 +107,25 @@ namespace ggb
 		void setColorCorrectionEnabled(bool enabled);
 		void updateLCDMode();
 		void updateEnabled();
+		void updateDMGPalettes(); // Has to be called after BGP, OBP0 or OBP1 was written
+		uint64_t getFrameCount() const; // Number of times VBlank was entered, e.g. to detect a completed frame
+		// Has to be called together with the reset of the scheduler cycle, e.g. after a state was loaded
+		void resetFrameCount();
+		// Only every n-th frame is rendered (1 = every frame), the timing, interrupts and HBlank DMA are not affected
+		void setFrameSkip(int renderEveryNthFrame);
+		// Has to be called after tile data in VRAM was written, vramIndex is relative to the start of the bank
+		void invalidateTileData(size_t bank, uint16_t vramIndex, uint16_t sizeInBytes);
+		// Renders the frames even without a game renderer, so they can be read with getCompletedFrame
+		void setFrameOutputEnabled(bool enabled);
+		FrameView getCompletedFrame() const;
+		// Every completed frame is also copied into the exchange, without waiting for the consumer
+		void setFrameExchange(std::shared_ptr<FrameExchange> exchange);
+		// The scanlines are written in this format directly (RGB by default), it applies to getCompletedFrame and the exchange.
+		// The game renderer only supports RGB, other formats are rejected while it is set and false is returned
+		bool setPixelFormat(PixelFormat format);
+		// Downscaled observation of every rendered frame (std::nullopt disables it), written while the scanlines are composed
+		void setObservation(std::optional<ObservationSettings> settings);
+		FrameView getObservation() const; // Empty if the observation is disabled
 
 	private:
 		// Helper struct for rendering the current scanline
@@ -110,46 +138,80 @@ namespace ggb
 			int screenXPos = 0;
 		};
 
-		void renderGame();
+		void completeFrame();
+		bool isFrameRendered(uint64_t frame) const;
+		using ScanlineRendering = void (PixelProcessingUnit::*)();
+
+		// Selects the scanline rendering for the current GBC mode and pixel format,
+		// nothing is rendered without a game renderer, frame output, exchange or observation
+		void updateScanlineRendering();
+		template <bool GBCMode>
+		ScanlineRendering getScanlineRendering() const;
+		// The scanline rendering is instantiated for DMG and GBC mode, so it doesn't check the mode per tile / pixel
+		template <bool GBCMode, PixelFormat Format>
 		void writeCurrentScanLineIntoFrameBuffer();
+		template <bool GBCMode>
 		void updateCurrentScanlineObjects();
+		template <bool GBCMode>
 		void writeCurrentBackgroundLineIntoFrameBuffer();
+		template <bool GBCMode>
 		void writeTileIntoBuffer(RenderingScanlineData* inOutData);
+		template <bool GBCMode>
 		void writeCurrentWindowLineIntoBuffer();
+		template <bool GBCMode>
 		void writeCurrentObjectLineIntoBuffer();
-		uint8_t* getVRAMBankPointer(uint8_t attributes);
+		template <bool GBCMode>
+		size_t getVRAMBank(uint8_t attributes) const;
 		uint16_t getTileAddress(uint16_t tileIndexAddress, bool useSignedAddressing);
 		void handleModeTransitionInterrupt(LCDInterrupt type);
 		constexpr int getModeDuration(LCDMode mode) const;
 		uint8_t scanLine() const;
 		uint8_t incrementScanline();
-		ColorPalette getBackgroundAndWindowColorPalette() const;
+		const ColorPalette& getBackgroundAndWindowColorPalette() const;
+		template <bool GBCMode>
 		const ColorPalette& GBCGetBackgroundAndWindowColorPalette(size_t index) const;
-		ColorPalette GBCGetObjectColorPalette(const Object& obj) const;
+		template <bool GBCMode>
+		const ColorPalette& GBCGetObjectColorPalette(const Object& obj) const;
 		void updateAndRenderTileData();
 		int getObjectHeight() const;
 		uint8_t getBackgroundTileAttributes(uint16_t address) const;
 
 		BUS* m_bus = nullptr;
+		const Scheduler* m_scheduler = nullptr;
 		bool m_enabled = false;
 		LCDMode m_currentMode = LCDMode::HBLank;
 		int m_currentModeDuration = 0;
 		int m_cycleCounter = 0;
+		uint64_t m_frameCount = 0;
+		int m_renderEveryNthFrame = 1;
 		bool m_drawWholeBackground = false;
 		bool m_drawTileData = false;
 		bool m_GBCMode = true;
 		bool m_colorCorrectionEnabled = false;
+		ScanlineRendering m_writeCurrentScanLine = nullptr; // nullptr if nothing is rendered
+		PixelFormat m_pixelFormat = PixelFormat::RGB;
+		std::vector<uint8_t> m_formattedFrame; // The frame in every pixel format except RGB, which uses m_gameFrameBuffer
+		bool m_frameOutputEnabled = false;
+		uint64_t m_completedFrameNumber = 0;
+		uint64_t m_completedFrameCycle = 0;
 		std::vector<Object> m_objects;
 		std::vector<Object> m_currentScanlineObjects;
 		std::vector<Tile> m_vramTiles;
+		TileCache m_tileCache;
 		std::vector<uint8_t> m_objColorBuffer;
 		std::vector<BackgroundAndWindowPixel> m_backgroundAndWindowPixelBuffer;
 		std::vector<ObjectPixel> m_currentObjectRowPixelBuffer;
+		std::array<uint8_t, GAME_WINDOW_WIDTH> m_currentObjectRowColorValues = {}; // Only valid where an object pixel is set
+		std::array<uint8_t, GAME_WINDOW_WIDTH> m_observationLine = {};
+		std::unique_ptr<ObservationBuffer> m_observation;
 		GBCColorRAM m_GBCBackgroundColorRAM = GBCColorRAM(GBC_BACKGROUND_PALETTE_SPECIFICATION_ADDRESS);
 		GBCColorRAM m_GBCObjectColorRAM = GBCColorRAM(GBC_OBJECT_COLOR_PALETTE_SPECIFICATION_ADDRESS);
 		ColorPalette m_backgroundPaletteValue = {};
+		ColorPalette m_objectPalette0Value = {};
+		ColorPalette m_objectPalette1Value = {};
 		std::unique_ptr<Renderer> m_tileDataRenderer;
 		std::unique_ptr<Renderer> m_gameRenderer;
+		std::shared_ptr<FrameExchange> m_frameExchange;
 		std::unique_ptr<FrameBuffer> m_gameFrameBuffer;
 		std::unique_ptr<FrameBuffer> m_tileDataFrameBuffer;
 		const uint8_t* m_LCDControl = nullptr;
@@ -5,6 +5,7 @@
 
 #include "BUS.hpp"
 #include "Serialization.hpp"
+#include "TripleBuffer.hpp"
 
 
 namespace ggb 
@@ -27,7 +28,7 @@ namespace ggb
 		RGB* getRow(size_t y);
 		void setPixel(size_t x, size_t y, const RGB& pixelValue);
 		RGB getPixel(size_t x, size_t y) const;
-        std::vector<RGB> getRawData() const;
+		const std::vector<RGB>& getRawData() const;
 		void serialization(Serialization* serialization);
 		std::vector<RGB>& getRawData();
 		size_t width() const;
@@ -41,6 +42,44 @@ namespace ggb
 		std::vector<RGB> m_buffer;
 	};
 
+	enum class PixelFormat
+	{
+		RGB, // The RGB struct of the FrameBuffer (red, green, blue, padding), the only format passed to the game renderer
+		RGBA8888, // One byte per channel in this order, alpha is always 255
+		BGRA8888,
+		RGB565, // 16 bit in native byte order, red in the upper 5 bits
+		PALETTE_INDEX, // The 2 bit color value (0 - 3) of the pixel, one byte per pixel
+		GRAYSCALE8,
+	};
+
+	size_t getBytesPerPixel(PixelFormat format);
+
+	// Read only view of a completed frame, the pixels are stored row by row (width * height * bytes per pixel).
+	// It is only valid until the emulation continues, as the next frame is rendered into the same memory
+	struct FrameView
+	{
+		const uint8_t* pixels = nullptr;
+		PixelFormat format = PixelFormat::RGB;
+		size_t width = 0;
+		size_t height = 0;
+		// frameNumber and cycle both count from the last reset or loaded state, they are not part of the saved state
+		uint64_t frameNumber = 0; // Frame count of the PPU (entered VBlanks) when the frame was completed, 0 if there is none yet
+		uint64_t cycle = 0; // Cpu cycle at which the frame was completed
+	};
+
+	// A completed frame handed over to another thread, e.g. a render thread
+	struct CompletedFrame
+	{
+		std::vector<uint8_t> pixels; // Same layout as the pixels of FrameView
+		PixelFormat format = PixelFormat::RGB;
+		size_t width = 0;
+		size_t height = 0;
+		uint64_t frameNumber = 0;
+		uint64_t cycle = 0;
+	};
+
+	using FrameExchange = TripleBuffer<CompletedFrame>;
+
 	class Renderer
 	{
 	public:
@@ -62,6 +101,8 @@ namespace ggb
 		const RGB& getColor(size_t index) const;
 	};
 
+	using TileRowData = std::array<uint8_t, TILE_WIDTH>; // The color values (0 - 3) of one row of a tile, from left to right
+
 	struct Tile 
 	{
 		explicit Tile() = default;
@@ -73,7 +114,9 @@ namespace ggb
 	// The colors on a gameboy color screen appear different than on a VGA / HDMI PC monitor
 	// Therefore color correction is needed to get (closer to) the look of a gameboy color
 	RGB colorCorrection(ggb::RGB rgb);
-	RGB convertGBColorToRGB(GBColor color);
+	RGB convertGBColorToRGB(GBColor color, bool colorCorrected = false);
+	// Converts a color of the GBC color RAM (15 bit BGR) with a lookup table, which is built once for both variants
+	const RGB& convertGBCColorToRGB(uint16_t color, bool colorCorrected);
 	void overWriteTileData(BUS* bus, uint16_t tileIndex, const ColorPalette& palette, Tile* outTile, std::vector<uint8_t>& bufVec);
-	void getTileRowData(const uint8_t* vramPtr, uint16_t tileAddress, uint8_t tileRow, std::vector<uint8_t>& outVec);
+	TileRowData getTileRowData(const uint8_t* vramPtr, uint16_t tileAddress, uint8_t tileRow, bool flipX);
 }
\ No newline at end of file
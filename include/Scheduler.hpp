@@ -0,0 +1,62 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ggb
+{
+	class PixelProcessingUnit;
+	class Timer;
+	class AudioProcessingUnit;
+
+	// Keeps the absolute cpu cycle of the next event (mode transition, TIMA overflow, frame sequencer tick, sample...)
+	// of every component. The cpu runs until the earliest one without stepping the components in between,
+	// they are only brought up to date when the deadline is reached or one of their registers is accessed.
+	class Scheduler
+	{
+	public:
+		enum class Component
+		{
+			PPU,
+			TIMER,
+			AUDIO,
+			COUNT,
+		};
+
+		void reset();
+		void setComponents(PixelProcessingUnit* ppu, Timer* timer, AudioProcessingUnit* audio);
+		// The PPU and the APU only get half of the cpu cycles in GBC double speed mode, audio is not emulated in AI mode
+		void setMode(bool doubleSpeed, bool audioEnabled);
+		// Steps the component up to the current cycle and schedules its next event
+		void synchronize(Component component);
+		void synchronizeAll(); // E.g. before the state is serialized
+		// Components without a due event keep lagging behind until their deadline or the next access of their registers
+		void synchronizeDueComponents();
+		// Has to be called after a register write changed when the next event of the component happens
+		void reschedule(Component component);
+		// Ends the current run after the current instruction (e.g. the cpu speed changed)
+		void requestSynchronization();
+
+		// Called for every instruction
+		void advance(int cycles) { m_currentCycle += cycles; }
+		uint64_t getCurrentCycle() const { return m_currentCycle; }
+		uint64_t getNextDeadline() const { return m_nextDeadline; }
+
+	private:
+		static constexpr size_t COMPONENT_COUNT = static_cast<size_t>(Component::COUNT);
+
+		void stepComponent(Component component, int cycles);
+		int cyclesUntilNextEvent(Component component) const; // In cpu cycles
+		void updateNextDeadline();
+
+		PixelProcessingUnit* m_ppu = nullptr;
+		Timer* m_timer = nullptr;
+		AudioProcessingUnit* m_audio = nullptr;
+		uint64_t m_currentCycle = 0;
+		uint64_t m_nextDeadline = 0;
+		std::array<uint64_t, COMPONENT_COUNT> m_deadlines = {};
+		std::array<uint64_t, COMPONENT_COUNT> m_lastSynchronization = {};
+		bool m_doubleSpeed = false;
+		bool m_audioEnabled = true;
+	};
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+#include "Constants.hpp"
+#include "RenderingUtility.hpp"
+
+namespace ggb
+{
+	// The tiles of both VRAM banks decoded into color values, so rendering doesn't decode the same tile rows
+	// again for every scanline. VRAM writes mark the written tile as dirty, it is decoded again when it's used next
+	class TileCache
+	{
+	public:
+		TileCache();
+		void setVRAM(const uint8_t* bank0, const uint8_t* bank1);
+		// vramIndex is relative to the start of the VRAM bank, writes to the tile maps are ignored
+		void invalidate(size_t bank, uint16_t vramIndex, uint16_t sizeInBytes);
+		void invalidateAll(); // E.g. after the whole VRAM was replaced
+		// The tile row may be larger than the tile height, e.g. 8x16 objects continue with the following tile
+		const TileRowData& getTileRow(size_t bank, uint16_t tileAddress, int tileRow, bool flipX)
+		{
+			const size_t tileIndex = ((tileAddress - TILE_MAP_1_ADDRESS) / TILE_MEMORY_SIZE) + (tileRow / TILE_HEIGHT);
+			if (m_dirty[bank][tileIndex])
+				decodeTile(bank, tileIndex);
+
+			const auto& tile = m_tiles[bank][tileIndex];
+			return flipX ? tile.flippedRows[tileRow % TILE_HEIGHT] : tile.rows[tileRow % TILE_HEIGHT];
+		}
+
+	private:
+		struct DecodedTile
+		{
+			std::array<TileRowData, TILE_HEIGHT> rows;
+			std::array<TileRowData, TILE_HEIGHT> flippedRows;
+		};
+
+		void decodeTile(size_t bank, size_t tileIndex);
+
+		std::array<const uint8_t*, GBC_VRAM_BANK_COUNT> m_vram = {};
+		std::array<std::array<DecodedTile, VRAM_TILE_COUNT>, GBC_VRAM_BANK_COUNT> m_tiles = {};
+		std::array<std::array<bool, VRAM_TILE_COUNT>, GBC_VRAM_BANK_COUNT> m_dirty = {};
+	};
+}
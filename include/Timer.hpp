@@ -11,6 +11,8 @@ namespace ggb
 		void reset();
 		void setBus(BUS* bus);
 		void step(int elapsedCycles);
+		// Cycles until TIMA overflows, any step with fewer cycles does not request an interrupt
+		int cyclesUntilNextEvent() const;
 		void resetDividerRegister();
 		void serialization(Serialization* serialization);
 		void updateAfterWrite();
@@ -0,0 +1,54 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace ggb
+{
+	/// Lock free exchange of the newest value (e.g. a frame) between one producer and one consumer thread.
+	/// The producer writes into its own buffer and swaps it with the shared one, the consumer swaps the shared one
+	/// with its read buffer. Neither of them waits and no buffer is accessed by both threads at the same time
+	template<typename T>
+	class TripleBuffer
+	{
+	public:
+		// Producer only
+		T& getWriteBuffer()
+		{
+			return m_buffers[m_writeIndex];
+		}
+
+		// Producer only, a published value that wasn't read yet is replaced
+		void publish()
+		{
+			const auto previous = m_sharedIndex.exchange(m_writeIndex | NEW_DATA_FLAG, std::memory_order_acq_rel);
+			m_writeIndex = previous & INDEX_MASK;
+		}
+
+		// Consumer only, returns false if nothing was published since the last call (the read buffer stays the same)
+		bool update()
+		{
+			if (!(m_sharedIndex.load(std::memory_order_relaxed) & NEW_DATA_FLAG))
+				return false;
+
+			const auto previous = m_sharedIndex.exchange(m_readIndex, std::memory_order_acq_rel);
+			m_readIndex = previous & INDEX_MASK;
+			return true;
+		}
+
+		// Consumer only
+		const T& getReadBuffer() const
+		{
+			return m_buffers[m_readIndex];
+		}
+
+	private:
+		static constexpr uint8_t INDEX_MASK = 0b11;
+		static constexpr uint8_t NEW_DATA_FLAG = 0b100;
+
+		std::array<T, 3> m_buffers = {};
+		std::atomic<uint8_t> m_sharedIndex = 1;
+		uint8_t m_writeIndex = 0;
+		uint8_t m_readIndex = 2;
+	};
+}
@@ -1,7 +1,13 @@
 #include "Audio/AudioProcessingUnit.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "Utility.hpp"
 
+static constexpr auto FRAME_SEQUENCER_FREQUENCY = 512;
+static constexpr auto CPU_CLOCKS_PER_FRAME_SEQUENCER_INCREASE = static_cast<int>(ggb::CPU_BASE_CLOCK / FRAME_SEQUENCER_FREQUENCY);
+
 ggb::AudioProcessingUnit::AudioProcessingUnit(BUS* bus)
 {
 	m_sampleBuffer = std::make_unique<SampleBuffer>();
@@ -28,12 +34,6 @@ void ggb::AudioProcessingUnit::setBus(BUS* bus)
 
 bool ggb::AudioProcessingUnit::write(uint16_t address, uint8_t value)
 {
-	for (auto channel : m_channels)
-	{
-		if (channel->isChannelAddress(address))
-			return channel->write(address, value);
-	}
-
 	if (address == AUDIO_MASTER_CONTROL_ADDRESS)
 	{
 		setBitToValue<7>(*m_soundOn, isBitSet<7>(value));
@@ -44,12 +44,6 @@ bool ggb::AudioProcessingUnit::write(uint16_t address, uint8_t value)
 
 std::optional<uint8_t> ggb::AudioProcessingUnit::read(uint16_t address) const
 {
-	for (auto channel : m_channels)
-	{
-		if (channel->isChannelAddress(address))
-			return channel->read(address);
-	}
-
 	if (address == AUDIO_MASTER_CONTROL_ADDRESS)
 	{
 		uint8_t result = 0;
@@ -65,6 +59,26 @@ std::optional<uint8_t> ggb::AudioProcessingUnit::read(uint16_t address) const
 	return {};
 }
 
+bool ggb::AudioProcessingUnit::writeChannel(size_t channelID, uint16_t address, uint8_t value)
+{
+	return m_channels[channelID]->write(address, value);
+}
+
+std::optional<uint8_t> ggb::AudioProcessingUnit::readChannel(size_t channelID, uint16_t address) const
+{
+	return m_channels[channelID]->read(address);
+}
+
+std::optional<size_t> ggb::AudioProcessingUnit::getChannelID(uint16_t address) const
+{
+	for (size_t i = 0; i < std::size(m_channels); ++i)
+	{
+		if (m_channels[i]->isChannelAddress(address))
+			return i;
+	}
+	return std::nullopt;
+}
+
 void ggb::AudioProcessingUnit::step(int cyclesPassed)
 {
 	if (!isBitSet<7>(*m_soundOn))
@@ -80,6 +94,17 @@ void ggb::AudioProcessingUnit::step(int cyclesPassed)
 	sampleGeneratorStep(cyclesPassed);
 }
 
+int ggb::AudioProcessingUnit::cyclesUntilNextEvent() const
+{
+	if (!isBitSet<7>(*m_soundOn))
+		return NO_PENDING_EVENT;
+
+	const int untilNextSample = static_cast<int>(std::ceil(m_sampleGeneratingRate - m_cycleCounter));
+	return std::min({ CPU_CLOCKS_PER_FRAME_SEQUENCER_INCREASE - m_frameFrequencerCounter, untilNextSample,
+		m_channel1->cyclesUntilNextEvent(), m_channel2->cyclesUntilNextEvent(), 
+		m_channel3->cyclesUntilNextEvent(), m_channel4->cyclesUntilNextEvent() });
+}
+
 ggb::SampleBuffer* ggb::AudioProcessingUnit::getSampleBuffer()
 {
 	return m_sampleBuffer.get();
@@ -157,9 +182,6 @@ void ggb::AudioProcessingUnit::sampleGeneratorStep(int cyclesPassed)
 
 void ggb::AudioProcessingUnit::frameSequencerStep(int cyclesPassed)
 {
-	constexpr auto FRAME_SEQUENCER_FREQUENCY = 512;
-	constexpr auto CPU_CLOCKS_PER_FRAME_SEQUENCER_INCREASE = CPU_BASE_CLOCK / FRAME_SEQUENCER_FREQUENCY;
-
 	m_frameFrequencerCounter += cyclesPassed;
 	if (m_frameFrequencerCounter >= CPU_CLOCKS_PER_FRAME_SEQUENCER_INCREASE)
 	{
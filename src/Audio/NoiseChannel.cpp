@@ -13,11 +13,7 @@ void ggb::NoiseChannel::step(int cyclesPassed)
 	if (!m_isOn)
 		return;
 
-	static constexpr int indexToDivisorMapping[] = { 8, 16, 32, 48, 64, 80, 96, 112 };
-	const auto divider = getClockDivider();
-	const auto shift = getClockShift();
-
-	const auto timer = indexToDivisorMapping[divider] << shift;
+	const auto timer = getLFSRTimer();
 	m_cycleCounter += cyclesPassed;
 	if (m_cycleCounter >= timer)
 	{
@@ -26,6 +22,13 @@ void ggb::NoiseChannel::step(int cyclesPassed)
 	}
 }
 
+int ggb::NoiseChannel::cyclesUntilNextEvent() const
+{
+	if (!m_isOn)
+		return NO_PENDING_EVENT;
+	return getLFSRTimer() - m_cycleCounter;
+}
+
 void ggb::NoiseChannel::setBus(BUS* bus)
 {
 	m_lengthTimer = bus->getPointerIntoMemory(AUDIO_CHANNEL_4_LENGTH_TIMER_ADDRESS);
@@ -191,6 +194,12 @@ bool ggb::NoiseChannel::isLFSR7Bit() const
 	return isBitSet<3>(*m_frequencyAndRandomness);
 }
 
+int ggb::NoiseChannel::getLFSRTimer() const
+{
+	static constexpr int indexToDivisorMapping[] = { 8, 16, 32, 48, 64, 80, 96, 112 };
+	return indexToDivisorMapping[getClockDivider()] << getClockShift();
+}
+
 int ggb::NoiseChannel::getClockShift() const
 {
 	return (*m_frequencyAndRandomness & 0b11110000) >> 4;
@@ -24,6 +24,13 @@ void ggb::SquareWaveChannel::step(int cyclesPassed)
 	}
 }
 
+int ggb::SquareWaveChannel::cyclesUntilNextEvent() const
+{
+	if (!m_isOn)
+		return NO_PENDING_EVENT;
+	return m_periodCounter;
+}
+
 void ggb::SquareWaveChannel::setBus(BUS* bus)
 {
 	if (m_hasSweep)
@@ -28,6 +28,13 @@ void ggb::WaveChannel::step(int cyclesPassed)
 	}
 }
 
+int ggb::WaveChannel::cyclesUntilNextEvent() const
+{
+	if (!m_isOn)
+		return NO_PENDING_EVENT;
+	return m_periodCounter;
+}
+
 void ggb::WaveChannel::setBus(BUS* bus)
 {
 	m_enabled = bus->getPointerIntoMemory(AUDIO_CHANNEL_3_DAC_ENABLE_ADDRESS);
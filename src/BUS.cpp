@@ -1,6 +1,9 @@
 #include "BUS.hpp"
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <iostream>
+#include <optional>
 
 #include "Audio/AudioProcessingUnit.hpp"
 #include "Constants.hpp"
@@ -8,14 +11,19 @@
 #include "Timer.hpp"
 #include "PixelProcessingUnit.hpp"
 #include "Input.hpp"
+#include "Scheduler.hpp"
+
+using Component = ggb::Scheduler::Component;
+
+ggb::BUS::BUS()
+{
+	updateMemoryPages();
+}
 
 void ggb::BUS::reset()
 {
-	m_memory = std::vector<uint8_t>(uint16_t{ 0xFFFF } + 1, 0);
-	for (auto& elem : m_vram)
-		std::fill(std::begin(elem), std::end(elem), 0);
-	for (auto& elem : m_wram)
-		std::fill(std::begin(elem), std::end(elem), 0);
+	m_memory = {};
+	m_validMemory = true;
 
 	m_memory[INPUT_REGISTER_ADDRESS] = 0xCF;
 	m_memory[SERIAL_TRANSFER_ADDRESS] = 0x00;
@@ -74,11 +82,37 @@ void ggb::BUS::reset()
 	m_memory[ENABLED_INTERRUPT_ADDRESS] = 0x00;
 
 	updateGBCDoubleSpeed();
+	updateMemoryPages();
 }
 
 void ggb::BUS::setCartridge(Cartridge* cartridge)
 {
 	m_cartridge = cartridge;
+	updateCartridgeMemoryPages();
+}
+
+void ggb::BUS::updateCartridgeMemoryPages()
+{
+	const MappedBanks banks = m_cartridge ? m_cartridge->getMappedBanks() : MappedBanks{};
+	auto mapPages = [this](uint16_t startAddress, uint16_t endAddress, const uint8_t* readMemory, uint8_t* writeMemory)
+	{
+		// Most bank selection writes select the bank that is already mapped
+		if (m_readPages[startAddress >> 8] == readMemory && m_writePages[startAddress >> 8] == writeMemory)
+			return;
+		for (size_t page = startAddress >> 8; page <= (endAddress >> 8); ++page)
+		{
+			const size_t offset = (page << 8) - startAddress;
+			m_readPages[page] = readMemory ? readMemory + offset : nullptr;
+			m_writePages[page] = writeMemory ? writeMemory + offset : nullptr;
+		}
+	};
+
+	// Writes into the ROM area select the banks and always go through the cartridge
+	mapPages(CARTRIDGE_ROM_START_ADDRESS, CARTRIDGE_ROM_START_ADDRESS + ROM_BANK_SIZE - 1, banks.fixedROMBank, nullptr);
+	mapPages(CARTRIDGE_ROM_START_ADDRESS + ROM_BANK_SIZE, CARTRIDGE_ROM_END_ADDRESS, banks.switchableROMBank, nullptr);
+	mapPages(CARTRIDGE_RAM_START_ADDRESS, CARTRIDGE_RAM_END_ADDRESS, banks.readableRAMBank, banks.writableRAMBank);
+	if (m_cartridge)
+		m_romBankNumber = m_cartridge->getROMBankNumber();
 }
 
 void ggb::BUS::setTimer(Timer* timer)
@@ -101,44 +135,66 @@ void ggb::BUS::setInput(Input* input)
 	m_input = input;
 }
 
+void ggb::BUS::setScheduler(Scheduler* scheduler)
+{
+	m_scheduler = scheduler;
+}
+
+void ggb::BUS::buildIORegisterTable()
+{
+	auto setRegister = [this](uint16_t address, auto read, auto write)
+	{
+		m_ioRegisters[address - IO_REGISTERS_START_ADDRESS] = IORegister{ read, write };
+	};
+
+	for (uint16_t address = IO_REGISTERS_START_ADDRESS; address <= IO_REGISTERS_END_ADDRESS; ++address)
+		setRegister(address, readMemory, writeMemory);
+
+	setRegister(INPUT_REGISTER_ADDRESS, readMemory, writeInput);
+	setRegister(TIMER_DIVIDER_REGISTER_ADDRESS, readTimerCounter, writeTimerDivider);
+	setRegister(TIMER_COUNTER_ADDRESS, readTimerCounter, writeTimerRegister);
+	setRegister(TIMER_MODULO_ADDRESS, readMemory, writeTimerRegister);
+	setRegister(TIMER_CONTROL_ADDRESS, readMemory, writeTimerControl);
+	for (uint16_t address = AUDIO_MEMORY_START_ADDRESS; address <= AUDIO_MEMORY_END_ADDRESS; ++address)
+	{
+		switch (m_audio->getChannelID(address).value_or(std::size_t(-1)))
+		{
+		case 0: setRegister(address, readAudioChannel<0>, writeAudioChannel<0>); break;
+		case 1: setRegister(address, readAudioChannel<1>, writeAudioChannel<1>); break;
+		case 2: setRegister(address, readAudioChannel<2>, writeAudioChannel<2>); break;
+		case 3: setRegister(address, readAudioChannel<3>, writeAudioChannel<3>); break;
+		default: setRegister(address, readAudio, writeAudio); break;
+		}
+	}
+	setRegister(LCD_CONTROL_REGISTER_ADDRESS, readMemory, writeLCDControl);
+	setRegister(LCD_STATUS_REGISTER_ADDRESS, readMemory, writeLCDStatus);
+	setRegister(START_DIRECT_MEMORY_ACCESS_ADDRESS, readWriteOnly, writeDirectMemoryAccess);
+	setRegister(BACKGROUND_PALETTE_ADDRESS, readMemory, writeDMGPalette);
+	setRegister(OBJECT_PALETTE_0_ADDRESS, readMemory, writeDMGPalette);
+	setRegister(OBJECT_PALETTE_1_ADDRESS, readMemory, writeDMGPalette);
+	setRegister(GBC_SPEED_SWITCH_ADDRESS, readMemory, writeSpeedSwitch);
+	setRegister(GBC_VRAM_BANKING_ADDRESS, readVRAMBank, writeBankSelection);
+	setRegister(GBC_VRAM_DMA_SOURCE_HIGH_ADDRESS, readWriteOnly, writeMemory);
+	setRegister(GBC_VRAM_DMA_SOURCE_LOW_ADDRESS, readWriteOnly, writeMemory);
+	setRegister(GBC_VRAM_DMA_DESTINATION_HIGH_ADDRESS, readWriteOnly, writeMemory);
+	setRegister(GBC_VRAM_DMA_DESTINATION_LOW_ADDRESS, readWriteOnly, writeMemory);
+	setRegister(GBC_VRAM_DMA_LENGTH_START_ADDRESS, readMemory, writeGBCVRAMDirectMemoryAccess);
+	setRegister(GBC_BACKGROUND_PALETTE_DATA_ADDRESS, readColorPaletteData, writeColorPaletteData);
+	setRegister(GBC_OBJECT_COLOR_PALETTE_DATA_ADDRESS, readColorPaletteData, writeColorPaletteData);
+	setRegister(GBC_WRAM_BANKING_ADDRESS, readMemory, writeBankSelection);
+}
+
 uint8_t ggb::BUS::read(uint16_t address) const
 {
-	if (isEchoRAMAddress(address))
-		address -= (ECHO_RAM_START_ADDRESS - WRAM_START_ADDRESS);
+	if (const uint8_t* page = m_readPages[address >> 8])
+		return page[address & 0xFF];
+
 	if (isCartridgeROMAddress(address) || isCartridgeRAMAddress(address))
 		return m_cartridge->read(address);
+	if (isIORegisterAddress(address))
+		return m_ioRegisters[address - IO_REGISTERS_START_ADDRESS].read(this, address);
 	if (isUnusedMemoryAddress(address))
 		return 0xFF; // Reading from unused/invalid memory
-	if (address == START_DIRECT_MEMORY_ACCESS_ADDRESS)
-		return 0xFF; // DMA Transfer address is write only
-	if (isAudioAddress(address))
-	{
-		auto value = m_audio->read(address);
-		if (value)
-			return value.value();
-	}
-
-	if (address == GBC_VRAM_BANKING_ADDRESS)
-	{
-		if (getActiveVRAMBank() == 1)
-			return 0xFF;
-		return 0xFE;
-	}
-	if (isVRAMAddress(address))
-		return m_vram[getActiveVRAMBank()][getVRAMIndexFromAddress(address)];
-	if (isWRAMAddress(address))
-		return m_wram[getWRAMBank(address)][getWRAMAddress(address)];
-	if (address == GBC_BACKGROUND_PALETTE_DATA_ADDRESS || address == GBC_OBJECT_COLOR_PALETTE_DATA_ADDRESS)
-		return m_ppu->GBCReadColorRAM(address);
-
-	if (address == GBC_VRAM_DMA_DESTINATION_HIGH_ADDRESS)
-		return 0xFF;
-	if (address == ggb::GBC_VRAM_DMA_DESTINATION_LOW_ADDRESS)
-		return 0xFF;
-	if (address == ggb::GBC_VRAM_DMA_SOURCE_HIGH_ADDRESS)
-		return 0xFF;
-	if (address == ggb::GBC_VRAM_DMA_SOURCE_LOW_ADDRESS)
-		return 0xFF;
 	return m_memory[address];
 }
 
@@ -150,88 +206,66 @@ int8_t ggb::BUS::readSigned(uint16_t address) const
 
 void ggb::BUS::write(uint16_t address, uint8_t value)
 {
-	if (isEchoRAMAddress(address))
-		address -= 0x2000;
-
-	if (isCartridgeROMAddress(address) || isCartridgeRAMAddress(address))
-	{
-		m_cartridge->write(address, value);
-		return;
-	}
-
-	if (address == TIMER_DIVIDER_REGISTER_ADDRESS)
-	{
-		resetTimerDivider();
-		return;
-	}
-
-	if (address == START_DIRECT_MEMORY_ACCESS_ADDRESS)
+	if (uint8_t* page = m_writePages[address >> 8])
 	{
-		directMemoryAccess(value);
+		page[address & 0xFF] = value;
 		return;
 	}
 
-	if (isAudioAddress(address))
-	{
-		if (m_audio->write(address, value))
-			return;
-	}
-
-	if (isUnusedMemoryAddress(address))
-		return; // Writing to unused/invalid memory does nothing
-
-	if (address == GBC_VRAM_DMA_LENGTH_START_ADDRESS)
+	if (isVRAMAddress(address))
 	{
-		m_memory[GBC_VRAM_DMA_LENGTH_START_ADDRESS] = value;
-		gbcVRAMDirectMemoryAccess();
+		const auto bank = getActiveVRAMBank();
+		const auto vramIndex = getVRAMIndexFromAddress(address);
+		m_memory.vram[bank][vramIndex] = value;
+		m_ppu->invalidateTileData(bank, vramIndex, 1);
 		return;
 	}
 
-	if (address == GBC_SPEED_SWITCH_ADDRESS) 
+	if (isCartridgeROMAddress(address))
 	{
-		if (isBitSet<0>(value))
-			toggleGBCDoubleSpeed();
+		m_cartridge->write(address, value);
+		updateCartridgeMemoryPages();
 		return;
 	}
 
-	if (address == GBC_BACKGROUND_PALETTE_DATA_ADDRESS || address == GBC_OBJECT_COLOR_PALETTE_DATA_ADDRESS) 
+	if (isCartridgeRAMAddress(address))
 	{
-		m_ppu->GBCWriteToColorRAM(address, value);
+		m_cartridge->write(address, value);
 		return;
 	}
 
-	if (isVRAMAddress(address))
+	if (isIORegisterAddress(address))
 	{
-		m_vram[getActiveVRAMBank()][getVRAMIndexFromAddress(address)] = value;
+		m_ioRegisters[address - IO_REGISTERS_START_ADDRESS].write(this, address, value);
 		return;
 	}
 
-	if (isWRAMAddress(address))
-	{
-		m_wram[getWRAMBank(address)][getWRAMAddress(address)] = value;
-		return;
-	}
+	if (isUnusedMemoryAddress(address))
+		return; // Writing to unused/invalid memory does nothing
 
 	m_memory[address] = value;
+}
 
-	if (address == INPUT_REGISTER_ADDRESS)
-	{
-		m_input->update();
-	}
-
-	if (address == TIMER_CONTROL_ADDRESS) 
-	{
-		m_timer->updateAfterWrite();
-	}
-
-	if (address == LCD_STATUS_REGISTER_ADDRESS) 
+void ggb::BUS::updateMemoryPages()
+{
+	auto mapPages = [this](uint16_t startAddress, uint16_t endAddress, uint8_t* memory)
 	{
-		m_ppu->updateLCDMode();
-	}
-
-	if (address == LCD_CONTROL_REGISTER_ADDRESS) 
+		for (size_t page = startAddress >> 8; page <= (endAddress >> 8); ++page)
+			m_readPages[page] = m_writePages[page] = memory + ((page << 8) - startAddress);
+	};
+
+	mapPages(VRAM_START_ADDRESS, VRAM_END_ADDRESS, m_memory.vram[getActiveVRAMBank()].data());
+	mapPages(WRAM_START_ADDRESS, WRAM_SWITCHABLE_BANK_START_ADDRESS - 1, m_memory.wram[0].data());
+	mapPages(WRAM_SWITCHABLE_BANK_START_ADDRESS, WRAM_END_ADDRESS, m_memory.wram[getWRAMBank(WRAM_SWITCHABLE_BANK_START_ADDRESS)].data());
+	// VRAM is only mapped for reading, writes have to invalidate the decoded tiles
+	for (size_t page = VRAM_START_ADDRESS >> 8; page <= (VRAM_END_ADDRESS >> 8); ++page)
+		m_writePages[page] = nullptr;
+	// Echo RAM mirrors 0xC000 - 0xDDFF
+	constexpr size_t echoPageOffset = (ECHO_RAM_START_ADDRESS - WRAM_START_ADDRESS) >> 8;
+	for (size_t page = ECHO_RAM_START_ADDRESS >> 8; page <= (ECHO_RAM_END_ADDRESS >> 8); ++page)
 	{
-		m_ppu->updateEnabled();
+		m_readPages[page] = m_readPages[page - echoPageOffset];
+		m_writePages[page] = m_writePages[page - echoPageOffset];
 	}
 }
 
@@ -243,7 +277,6 @@ void ggb::BUS::write(uint16_t address, uint16_t value)
 
 uint8_t* ggb::BUS::getPointerIntoMemory(uint16_t address)
 {
-	assert(address >= 0xF000);
 	return &m_memory[address];
 }
 
@@ -251,7 +284,7 @@ uint8_t* ggb::BUS::getVRAMStartPointer(size_t bank)
 {
 	if (bank > 1)
 		return nullptr;
-	return &(m_vram[bank][0]);
+	return m_memory.vram[bank].data();
 }
 
 void ggb::BUS::requestInterrupt(int interrupt)
@@ -261,16 +294,21 @@ void ggb::BUS::requestInterrupt(int interrupt)
 
 void ggb::BUS::resetTimerDivider()
 {
+	m_scheduler->synchronize(Component::TIMER); // Also called by STOP without a register write
 	m_timer->resetDividerRegister();
 }
 
 void ggb::BUS::serialization(Serialization* serialization)
 {
+	size_t memorySize = sizeof(m_memory);
+	serialization->read_write(memorySize);
+	m_validMemory = (memorySize == sizeof(m_memory));
+	if (!m_validMemory)
+		return;
 	serialization->read_write(m_memory);
-	serialization->read_write(m_wram);
-	serialization->read_write(m_vram);
 	serialization->read_write(m_hBlankDMA);
 	serialization->read_write(m_doubleSpeedOn);
+	updateMemoryPages();
 }
 
 void ggb::BUS::handleHBlank()
@@ -293,15 +331,21 @@ bool ggb::BUS::isGBCDoubleSpeedOn() const
 	return m_doubleSpeedOn;
 }
 
+int ggb::BUS::getROMBankNumber() const
+{
+	return m_romBankNumber;
+}
+
 bool ggb::BUS::valid() const
 {
-	return !m_memory.empty();
+	return m_validMemory;
 }
 
 void ggb::BUS::toggleGBCDoubleSpeed()
 {
 	setBitToValue<7>(m_memory[GBC_SPEED_SWITCH_ADDRESS], !m_doubleSpeedOn);
 	updateGBCDoubleSpeed();
+	m_scheduler->requestSynchronization(); // The components run with the new speed from the next instruction on
 
 	write(ENABLED_INTERRUPT_ADDRESS, static_cast<uint8_t>(0x00));
 	write(INPUT_REGISTER_ADDRESS, static_cast<uint8_t>(0x30));
@@ -321,16 +365,54 @@ void ggb::BUS::directMemoryAccess(uint8_t value)
 
 void ggb::BUS::directMemoryAccess(uint16_t sourceAddress, uint16_t destinationAddress, uint16_t sizeInBytes)
 {
-	// This is not really the most performant way to perform the DMA but it is the most easy to understand and most robust
-	for (uint16_t i = 0; i < sizeInBytes; i++) 
+	// Copied in chunks that neither cross a page of the source nor of the destination,
+	// so every chunk is either one contiguous span of memory or has to be copied byte by byte
+	while (sizeInBytes > 0)
 	{
-		uint16_t from = sourceAddress + i;
-		uint16_t to = destinationAddress + i;
-		auto value = read(from);
-		write(to, value);
+		const uint16_t chunkSize = std::min<uint16_t>({ sizeInBytes,
+			static_cast<uint16_t>(0x100 - (sourceAddress & 0xFF)),
+			static_cast<uint16_t>(0x100 - (destinationAddress & 0xFF)) });
+
+		const uint8_t* source = getDirectMemoryAccessSource(sourceAddress);
+		uint8_t* destination = getDirectMemoryAccessDestination(destinationAddress, chunkSize);
+		const bool overlapping = source && destination && source < destination + chunkSize && destination < source + chunkSize;
+		if (source && destination && !overlapping)
+		{
+			std::memcpy(destination, source, chunkSize);
+			if (isVRAMAddress(destinationAddress))
+				m_ppu->invalidateTileData(getActiveVRAMBank(), getVRAMIndexFromAddress(destinationAddress), chunkSize);
+		}
+		else
+		{
+			for (uint16_t i = 0; i < chunkSize; i++)
+				write(static_cast<uint16_t>(destinationAddress + i), read(static_cast<uint16_t>(sourceAddress + i)));
+		}
+
+		sourceAddress += chunkSize;
+		destinationAddress += chunkSize;
+		sizeInBytes -= chunkSize;
 	}
 }
 
+const uint8_t* ggb::BUS::getDirectMemoryAccessSource(uint16_t address) const
+{
+	if (const uint8_t* page = m_readPages[address >> 8])
+		return page + (address & 0xFF);
+	return nullptr;
+}
+
+uint8_t* ggb::BUS::getDirectMemoryAccessDestination(uint16_t address, uint16_t sizeInBytes)
+{
+	if (uint8_t* page = m_writePages[address >> 8])
+		return page + (address & 0xFF);
+	if (isVRAMAddress(address))
+		return m_memory.vram[getActiveVRAMBank()].data() + getVRAMIndexFromAddress(address);
+	// The rest of the OAM page is unused memory which ignores writes
+	if (isOAMAddress(address) && isOAMAddress(address + sizeInBytes - 1))
+		return &m_memory[address];
+	return nullptr;
+}
+
 // The timings of gbcDMA are currently not correct (maybe correct timings are mandatory for some games?)
 void ggb::BUS::gbcVRAMDirectMemoryAccess()
 {
@@ -360,7 +442,7 @@ void ggb::BUS::gbcVRAMDirectMemoryAccess()
 		return;
 	}
 
-	assert((getVRAMIndexFromAddress(dma.destination) + dma.length - 1) < std::size(m_vram[0]));
+	assert((getVRAMIndexFromAddress(dma.destination) + dma.length - 1) < std::size(m_memory.vram[0]));
 
 	directMemoryAccess(dma.source, dma.destination, dma.length);
 	m_memory[GBC_VRAM_DMA_LENGTH_START_ADDRESS] = 0xFF;
@@ -381,12 +463,144 @@ int ggb::BUS::getWRAMBank(uint16_t address) const
 	return std::max(m_memory[GBC_WRAM_BANKING_ADDRESS] & 0b111, 1);
 }
 
-uint16_t ggb::BUS::getWRAMAddress(uint16_t address) const
+uint8_t ggb::BUS::readMemory(const BUS* bus, uint16_t address)
 {
-	assert(isWRAMAddress(address));
-	if (address < WRAM_SWITCHABLE_BANK_START_ADDRESS)
-		return address - WRAM_START_ADDRESS;
-	return address - WRAM_SWITCHABLE_BANK_START_ADDRESS;
+	return bus->m_memory[address];
+}
+
+uint8_t ggb::BUS::readWriteOnly(const BUS*, uint16_t)
+{
+	return 0xFF;
+}
+
+uint8_t ggb::BUS::readTimerCounter(const BUS* bus, uint16_t address)
+{
+	bus->m_scheduler->synchronize(Component::TIMER);
+	return bus->m_memory[address];
+}
+
+uint8_t ggb::BUS::readAudio(const BUS* bus, uint16_t address)
+{
+	bus->m_scheduler->synchronize(Component::AUDIO);
+	return bus->m_audio->read(address).value_or(bus->m_memory[address]);
+}
+
+template <size_t ChannelID>
+uint8_t ggb::BUS::readAudioChannel(const BUS* bus, uint16_t address)
+{
+	bus->m_scheduler->synchronize(Component::AUDIO);
+	return bus->m_audio->readChannel(ChannelID, address).value_or(bus->m_memory[address]);
+}
+
+uint8_t ggb::BUS::readVRAMBank(const BUS* bus, uint16_t)
+{
+	if (bus->getActiveVRAMBank() == 1)
+		return 0xFF;
+	return 0xFE;
+}
+
+uint8_t ggb::BUS::readColorPaletteData(const BUS* bus, uint16_t address)
+{
+	return bus->m_ppu->GBCReadColorRAM(address);
+}
+
+void ggb::BUS::writeMemory(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_memory[address] = value;
+}
+
+void ggb::BUS::writeInput(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_memory[address] = value;
+	bus->m_input->update();
+}
+
+void ggb::BUS::writeTimerDivider(BUS* bus, uint16_t, uint8_t)
+{
+	bus->resetTimerDivider();
+	bus->m_scheduler->reschedule(Component::TIMER);
+}
+
+void ggb::BUS::writeTimerRegister(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_scheduler->synchronize(Component::TIMER);
+	bus->m_memory[address] = value;
+	bus->m_scheduler->reschedule(Component::TIMER);
+}
+
+void ggb::BUS::writeTimerControl(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_scheduler->synchronize(Component::TIMER);
+	bus->m_memory[address] = value;
+	bus->m_timer->updateAfterWrite();
+	bus->m_scheduler->reschedule(Component::TIMER);
+}
+
+void ggb::BUS::writeAudio(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_scheduler->synchronize(Component::AUDIO);
+	if (!bus->m_audio->write(address, value))
+		bus->m_memory[address] = value;
+	bus->m_scheduler->reschedule(Component::AUDIO);
+}
+
+template <size_t ChannelID>
+void ggb::BUS::writeAudioChannel(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_scheduler->synchronize(Component::AUDIO);
+	if (!bus->m_audio->writeChannel(ChannelID, address, value))
+		bus->m_memory[address] = value;
+	bus->m_scheduler->reschedule(Component::AUDIO);
+}
+
+void ggb::BUS::writeLCDControl(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_scheduler->synchronize(Component::PPU);
+	bus->m_memory[address] = value;
+	bus->m_ppu->updateEnabled();
+	bus->m_scheduler->reschedule(Component::PPU);
+}
+
+void ggb::BUS::writeLCDStatus(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_scheduler->synchronize(Component::PPU);
+	bus->m_memory[address] = value;
+	bus->m_ppu->updateLCDMode();
+	bus->m_scheduler->reschedule(Component::PPU);
+}
+
+void ggb::BUS::writeDirectMemoryAccess(BUS* bus, uint16_t, uint8_t value)
+{
+	bus->directMemoryAccess(value);
+}
+
+void ggb::BUS::writeDMGPalette(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_memory[address] = value;
+	bus->m_ppu->updateDMGPalettes();
+}
+
+void ggb::BUS::writeSpeedSwitch(BUS* bus, uint16_t, uint8_t value)
+{
+	if (isBitSet<0>(value))
+		bus->toggleGBCDoubleSpeed();
+}
+
+void ggb::BUS::writeBankSelection(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_memory[address] = value;
+	bus->updateMemoryPages();
+}
+
+void ggb::BUS::writeGBCVRAMDirectMemoryAccess(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_memory[address] = value;
+	bus->gbcVRAMDirectMemoryAccess();
+}
+
+void ggb::BUS::writeColorPaletteData(BUS* bus, uint16_t address, uint8_t value)
+{
+	bus->m_ppu->GBCWriteToColorRAM(address, value);
 }
 
 int ggb::getVRAMIndexFromAddress(uint16_t address)
@@ -0,0 +1,149 @@
+#include "BatchEmulator.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+ggb::BatchEmulator::BatchEmulator(size_t environmentCount, const ObservationSettings& observation, size_t threadCount)
+	: m_nextEnvironment(environmentCount)
+{
+	for (size_t i = 0; i < environmentCount; ++i)
+	{
+		m_environments.push_back(std::make_unique<Emulator>());
+		m_environments.back()->setObservation(observation);
+	}
+	m_done.resize(environmentCount, 0);
+
+	// The calling thread works on the environments as well
+	const size_t workerCount = std::min(std::max<size_t>(threadCount, 1), std::max<size_t>(environmentCount, 1)) - 1;
+	for (size_t i = 0; i < workerCount; ++i)
+		m_workers.emplace_back(&BatchEmulator::workerLoop, this);
+}
+
+ggb::BatchEmulator::~BatchEmulator()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_workAvailable.notify_all();
+	for (auto& worker : m_workers)
+		worker.join();
+}
+
+bool ggb::BatchEmulator::loadCartridge(const std::filesystem::path& path)
+{
+	bool loaded = true;
+	for (auto& environment : m_environments)
+		loaded = environment->loadCartridge(path) && loaded;
+	std::fill(m_done.begin(), m_done.end(), 0);
+	return loaded;
+}
+
+void ggb::BatchEmulator::setRewardFunction(RewardFunction rewardFunction)
+{
+	m_rewardFunction = std::move(rewardFunction);
+}
+
+void ggb::BatchEmulator::setDoneFunction(DoneFunction doneFunction)
+{
+	m_doneFunction = std::move(doneFunction);
+}
+
+void ggb::BatchEmulator::step(const GameboyInput* actions, int frameCount, const BatchBuffers& buffers)
+{
+	const size_t observationSize = getObservationSize();
+	runParallel([&](size_t environment)
+	{
+		auto& emulator = *m_environments[environment];
+		float reward = 0.0f;
+		emulator.setInputState(actions[environment]);
+		for (int frame = 0; frame < frameCount && !m_done[environment]; ++frame)
+		{
+			emulator.runFrameAiMode();
+			if (m_rewardFunction)
+				reward += m_rewardFunction(emulator, environment);
+			if (m_doneFunction && m_doneFunction(emulator, environment))
+				m_done[environment] = 1;
+		}
+
+		if (buffers.observations)
+		{
+			const auto observation = emulator.getObservation();
+			std::memcpy(buffers.observations + (environment * observationSize), observation.pixels, observationSize);
+		}
+		if (buffers.rewards)
+			buffers.rewards[environment] = reward;
+		if (buffers.done)
+			buffers.done[environment] = m_done[environment];
+	});
+}
+
+void ggb::BatchEmulator::reset(size_t environment)
+{
+	m_environments[environment]->reset();
+	m_done[environment] = 0;
+}
+
+size_t ggb::BatchEmulator::size() const
+{
+	return m_environments.size();
+}
+
+size_t ggb::BatchEmulator::getObservationSize() const
+{
+	if (m_environments.empty())
+		return 0;
+	const auto observation = m_environments.front()->getObservation();
+	return observation.width * observation.height * getBytesPerPixel(observation.format);
+}
+
+ggb::Emulator& ggb::BatchEmulator::getEnvironment(size_t environment)
+{
+	return *m_environments[environment];
+}
+
+void ggb::BatchEmulator::runParallel(const std::function<void(size_t)>& task)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = &task;
+		m_remainingTasks = m_environments.size();
+		m_nextEnvironment = 0; // Has to be the last, workers of the previous run may still take environments
+		++m_generation;
+	}
+	m_workAvailable.notify_all();
+	runTasks();
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_workFinished.wait(lock, [this] { return m_remainingTasks == 0; });
+}
+
+void ggb::BatchEmulator::runTasks()
+{
+	// Every thread takes the next environment that isn't running yet, so the threads which finish early take over the rest
+	for (size_t environment = m_nextEnvironment++; environment < m_environments.size(); environment = m_nextEnvironment++)
+	{
+		(*m_task)(environment);
+		if (--m_remainingTasks == 0)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_workFinished.notify_all();
+		}
+	}
+}
+
+void ggb::BatchEmulator::workerLoop()
+{
+	uint64_t generation = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_workAvailable.wait(lock, [&] { return m_stop || m_generation != generation; });
+			if (m_stop)
+				return;
+			generation = m_generation;
+		}
+		runTasks();
+	}
+}
@@ -0,0 +1,96 @@
+#include "BlockCache.hpp"
+
+#include "Constants.hpp"
+#include "Utility.hpp"
+
+static bool changesControlFlow(uint8_t opCode, const ggb::OPCodes::OPCode& opcode)
+{
+	if (opcode.branchCycleCount != 0)
+		return true; // Conditional jumps, calls and returns
+
+	switch (opCode)
+	{
+	case 0x18: // JR i8
+	case 0xC3: // JP u16
+	case 0xC9: // RET
+	case 0xCD: // CALL u16
+	case 0xD9: // RETI
+	case 0xE9: // JP HL
+		return true;
+	default:
+		return (opCode & 0xC7) == 0xC7; // RST
+	}
+}
+
+void ggb::BlockCache::clear()
+{
+	for (auto& block : m_blocks)
+		block = Block();
+}
+
+const ggb::BlockCache::Block* ggb::BlockCache::getBlock(uint16_t address, int romBank, const BUS* bus)
+{
+	if (!isCacheableAddress(address))
+		return nullptr;
+
+	const int bank = getBankKey(address, romBank);
+	auto& block = m_blocks[(address ^ (bank << 6)) & (BLOCK_COUNT - 1)];
+	if (block.address != address || block.bank != bank)
+	{
+		block.address = address;
+		block.bank = bank;
+		decode(&block, bus);
+	}
+
+	if (block.size == 0)
+		return nullptr;
+	return &block;
+}
+
+bool ggb::BlockCache::isStale(const Block& block, int romBank)
+{
+	return block.bank != getBankKey(block.address, romBank);
+}
+
+bool ggb::BlockCache::isCacheableAddress(uint16_t address)
+{
+	return isCartridgeROMAddress(address);
+}
+
+int ggb::BlockCache::getBankKey(uint16_t address, int romBank)
+{
+	if (address < ROM_BANK_SIZE)
+		return 0;
+	return romBank;
+}
+
+void ggb::BlockCache::decode(Block* block, const BUS* bus)
+{
+	// A block never crosses from the fixed into the switchable bank
+	const int lastAddress = block->address < ROM_BANK_SIZE ? ROM_BANK_SIZE - 1 : CARTRIDGE_ROM_END_ADDRESS;
+	uint16_t address = block->address;
+	block->size = 0;
+
+	while (block->size < MAX_BLOCK_LENGTH)
+	{
+		const uint8_t opCode = bus->read(address);
+		const OPCodes::OPCode* opcode = &OPCodes::getOpcode(opCode);
+		const int length = opcode->length;
+		if (address + length - 1 > lastAddress)
+			break;
+
+		uint16_t operand = 0;
+		if (opCode == 0xCB)
+			opcode = &OPCodes::getExtendedOpcode(bus->read(address + 1));
+		else if (length == 2)
+			operand = bus->read(address + 1);
+		else if (length == 3)
+			operand = combineUpperAndLower(bus->read(address + 2), bus->read(address + 1));
+
+		block->microOps[block->size++] = { opcode->func, operand, static_cast<uint8_t>(length) };
+		address += length;
+
+		if (changesControlFlow(opCode, *opcode))
+			break;
+	}
+}
@@ -30,6 +30,7 @@ void ggb::CPU::reset()
 	m_cpuState.StackPointer() = 0xFFFE;
 	m_cpuState.disableInterrupts();
 	m_cpuState.resume();
+	invalidateBlockCache();
 }
 
 void ggb::CPU::setBus(BUS* bus)
@@ -38,6 +39,12 @@ void ggb::CPU::setBus(BUS* bus)
 
 	m_requestedInterrupts = m_bus->getPointerIntoMemory(INTERRUPT_REQUEST_ADDRESS);
 	m_enabledInterrupts = m_bus->getPointerIntoMemory(ENABLED_INTERRUPT_ADDRESS);
+	invalidateBlockCache(); // The cartridge might have changed
+}
+
+void ggb::CPU::setScheduler(Scheduler* scheduler)
+{
+	m_scheduler = scheduler;
 }
 
 bool ggb::CPU::handleInterrupts()
@@ -77,19 +84,37 @@ bool ggb::CPU::handleInterrupts()
 	return false;
 }
 
-int ggb::CPU::step()
+int ggb::CPU::step(uint64_t endCycle)
 {
+	m_idleLoopCycles = 0;
 	if (handleInterrupts())
 		return 20; // 5 Machine cycles
 
 	if (m_cpuState.isStopped())
+	{
+		// Only an interrupt can wake the cpu up, which makes halting an idle loop of one machine cycle
+		m_idleLoopCycles = 4;
 		return 4; // For now we just say 4 clocks have gone by (one machine cycle)
+	}
 
-	const int instructionPointer = m_cpuState.InstructionPointer();
-	auto opCode = m_bus->read(instructionPointer);
-	debugLog(m_opcodes.getMnemonic(opCode));
-	++m_cpuState.InstructionPointer();
-	const int duration = m_opcodes.execute(opCode, &m_cpuState, m_bus);
+	const uint16_t instructionAddress = m_cpuState.getInstructionPointer();
+#ifdef GGB_BLOCK_CACHE
+	int duration = 0;
+	if (const auto* microOp = nextCachedMicroOp())
+	{
+		m_cpuState.InstructionPointer() += microOp->length;
+		duration = microOp->func(&m_cpuState, m_bus, microOp->operand);
+	}
+	else
+	{
+		duration = executeNextInstruction(endCycle);
+	}
+#else
+	const int duration = executeNextInstruction(endCycle);
+#endif
+	// Only short backward jumps can close an idle loop
+	if (m_idleLoopDetection && static_cast<uint16_t>(instructionAddress - m_cpuState.getInstructionPointer()) < IdleLoopDetector::MAX_LOOP_LENGTH)
+		detectIdleLoop(instructionAddress);
 
 	static constexpr bool readSerial = false;
 	if constexpr (readSerial)
@@ -107,6 +132,71 @@ int ggb::CPU::step()
 	return duration;
 }
 
+int ggb::CPU::getIdleLoopCycles() const
+{
+	return m_idleLoopCycles;
+}
+
+void ggb::CPU::setIdleLoopDetection(bool enabled)
+{
+	m_idleLoopDetection = enabled;
+	m_idleLoopCycles = 0;
+}
+
+int ggb::CPU::executeNextInstruction([[maybe_unused]] uint64_t endCycle)
+{
+#ifdef GGB_THREADED_INTERPRETER
+	// Runs up to the next component event, the scheduler already contains the cycles of all but the last instruction
+	return OPCodes::executeThreaded(&m_cpuState, m_bus, m_scheduler, endCycle, m_requestedInterrupts, m_enabledInterrupts);
+#else
+	const int instructionPointer = m_cpuState.InstructionPointer();
+	auto opCode = m_bus->read(instructionPointer);
+	debugLog(OPCodes::getMnemonic(opCode));
+	++m_cpuState.InstructionPointer();
+	return OPCodes::execute(opCode, &m_cpuState, m_bus);
+#endif
+}
+
+const ggb::BlockCache::MicroOp* ggb::CPU::nextCachedMicroOp()
+{
+	const uint16_t instructionPointer = m_cpuState.InstructionPointer();
+	const int romBank = m_bus->getROMBankNumber();
+
+	// Continue the current block as long as nothing jumped away and no other ROM bank got mapped in
+	const bool continueBlock = m_currentBlock 
+		&& instructionPointer == m_nextInstructionPointer 
+		&& m_currentMicroOp < m_currentBlock->size
+		&& !BlockCache::isStale(*m_currentBlock, romBank);
+
+	if (!continueBlock)
+	{
+		m_currentBlock = m_blockCache.getBlock(instructionPointer, romBank, m_bus);
+		m_currentMicroOp = 0;
+		if (!m_currentBlock)
+			return nullptr;
+	}
+
+	const auto* microOp = &m_currentBlock->microOps[m_currentMicroOp++];
+	m_nextInstructionPointer = instructionPointer + microOp->length;
+	return microOp;
+}
+
+void ggb::CPU::invalidateBlockCache()
+{
+	m_blockCache.clear();
+	m_currentBlock = nullptr;
+	m_currentMicroOp = 0;
+}
+
+void ggb::CPU::detectIdleLoop(uint16_t instructionAddress)
+{
+	// A pending interrupt would be serviced in the next step
+	if (*m_requestedInterrupts & *m_enabledInterrupts)
+		return;
+
+	m_idleLoopCycles = IdleLoopDetector::getIterationCycles(m_cpuState, m_bus, instructionAddress);
+}
+
 void ggb::CPU::serialization(Serialization* serialization)
 {
 	m_cpuState.serialization(serialization);
@@ -1,11 +1,14 @@
 #include "CPUInstructions.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <exception>
 #include <iostream>
 
 #include "CPU.hpp"
 #include "Logging.hpp"
+#include "Scheduler.hpp"
 #include "Utility.hpp"
 
 using namespace ggb;
@@ -17,11 +20,6 @@ static uint8_t read(CPUState* cpu, BUS* bus)
 	return result;
 }
 
-static int8_t readSigned(CPUState* cpu, BUS* bus)
-{
-	return static_cast<int8_t>(read(cpu, bus));
-}
-
 // Reads two bytes from the bus (instruction pointer) and returns them combined (first byte = upper, second byte = lower)
 static uint16_t readTwoBytes(CPUState* cpu, BUS* bus)
 {
@@ -31,6 +29,16 @@ static uint16_t readTwoBytes(CPUState* cpu, BUS* bus)
 	return combineUpperAndLower(upper, lower);
 }
 
+// Reads the immediate operand of an instruction, length is the instruction length in bytes (including the opcode)
+static uint16_t readOperand(CPUState* cpu, BUS* bus, int length)
+{
+	if (length == 2)
+		return read(cpu, bus);
+	if (length == 3)
+		return readTwoBytes(cpu, bus);
+	return 0;
+}
+
 static uint16_t popFromStack(CPUState* cpu, BUS* bus) 
 {
 	uint8_t lower = bus->read(cpu->StackPointer()++);
@@ -48,221 +56,318 @@ static void pushOnStack(CPUState* cpu, BUS* bus, uint16_t num)
 	bus->write(--cpu->StackPointer(), lower);
 }
 
+// Register operands in the order they are encoded in the lower three bits of an opcode
+enum RegisterIndex
+{
+	REGISTER_B,
+	REGISTER_C,
+	REGISTER_D,
+	REGISTER_E,
+	REGISTER_H,
+	REGISTER_L,
+	REGISTER_HL_ADDRESS, // The byte HL points to
+	REGISTER_A,
+};
+
+template <int Register>
+static uint8_t& getRegister(CPUState* cpu)
+{
+	static_assert(Register != REGISTER_HL_ADDRESS, "(HL) is not a register, use readRegister / writeRegister");
+	if constexpr (Register == REGISTER_B)
+		return cpu->B();
+	else if constexpr (Register == REGISTER_C)
+		return cpu->C();
+	else if constexpr (Register == REGISTER_D)
+		return cpu->D();
+	else if constexpr (Register == REGISTER_E)
+		return cpu->E();
+	else if constexpr (Register == REGISTER_H)
+		return cpu->H();
+	else if constexpr (Register == REGISTER_L)
+		return cpu->L();
+	else
+		return cpu->A();
+}
+
+template <int Register>
+static uint8_t readRegister(CPUState* cpu, BUS* bus)
+{
+	if constexpr (Register == REGISTER_HL_ADDRESS)
+		return bus->read(cpu->HL());
+	else
+		return getRegister<Register>(cpu);
+}
+
+template <int Register>
+static void writeRegister(CPUState* cpu, BUS* bus, uint8_t value)
+{
+	if constexpr (Register == REGISTER_HL_ADDRESS)
+		bus->write(cpu->HL(), value);
+	else
+		getRegister<Register>(cpu) = value;
+}
+
+// Every access of (HL) costs 4 additional cycles
+template <int Register>
+static constexpr int registerCycles(int cycles, int memoryAccesses = 1)
+{
+	return Register == REGISTER_HL_ADDRESS ? cycles + 4 * memoryAccesses : cycles;
+}
+
 
 
-static void invalidInstruction(CPUInstructionParameters)
+static int invalidInstruction(CPUInstructionParameters)
 {
 	assert(!"Tried to execute an invalid instruction");
 	throw std::runtime_error("Tried to execute an invalid instruction");
 }
 
-static void noop(CPUInstructionParameters)
+static int noop(CPUInstructionParameters)
 {
 	// noop does nothing -> therefore empty on purpose
+	return 4;
 }
 
-static void loadBCValue(CPUInstructionParameters)
+static int loadBCValue(CPUInstructionParameters)
 {
-	cpu->BC() = readTwoBytes(cpu, bus);
+	cpu->BC() = operand;
+	return 12;
 }
 
-static void writeAToAddressBC(CPUInstructionParameters)
+static int writeAToAddressBC(CPUInstructionParameters)
 {
 	bus->write(cpu->BC(), cpu->A());
+	return 8;
 }
 
-static void incrementBC(CPUInstructionParameters)
+static int incrementBC(CPUInstructionParameters)
 {
 	cpu->BC()++; // No flags set on purpose
+	return 8;
 }
 
-static void incrementB(CPUInstructionParameters)
+static int incrementB(CPUInstructionParameters)
 {
 	increment(cpu, cpu->B());
+	return 4;
 }
 
-static void decrementB(CPUInstructionParameters)
+static int decrementB(CPUInstructionParameters)
 {
 	decrement(cpu, cpu->B());
+	return 4;
 }
 
-static void loadNumberIntoB(CPUInstructionParameters)
+static int loadNumberIntoB(CPUInstructionParameters)
 {
-	cpu->B() = read(cpu, bus);
+	cpu->B() = static_cast<uint8_t>(operand);
+	return 8;
 }
 
-static void rotateALeft(CPUInstructionParameters)
+static int rotateALeft(CPUInstructionParameters)
 {
 	rotateLeft(cpu, cpu->A());
+	return 4;
 }
 
-static void loadStackPointerIntoAddress(CPUInstructionParameters)
+static int loadStackPointerIntoAddress(CPUInstructionParameters)
 {
-	auto address = readTwoBytes(cpu, bus);
+	auto address = operand;
 	uint8_t lower = static_cast<uint8_t>(cpu->StackPointer());
 	uint8_t upper = static_cast<uint8_t>(cpu->StackPointer() >> 8);
 	bus->write(address, lower);
 	bus->write(address + 1, upper);
+	return 20;
 }
 
-static void addBCToHL(CPUInstructionParameters)
+static int addBCToHL(CPUInstructionParameters)
 {
 	add(cpu, cpu->HL(), cpu->BC());
+	return 8;
 }
 
-static void loadValuePointedByBCIntoA(CPUInstructionParameters)
+static int loadValuePointedByBCIntoA(CPUInstructionParameters)
 {
 	cpu->A() = bus->read(cpu->BC());
+	return 8;
 }
 
-static void decrementBC(CPUInstructionParameters)
+static int decrementBC(CPUInstructionParameters)
 {
 	--cpu->BC();
+	return 8;
 }
 
-static void incrementC(CPUInstructionParameters)
+static int incrementC(CPUInstructionParameters)
 {
 	increment(cpu, cpu->C());
+	return 4;
 }
 
-static void decrementC(CPUInstructionParameters)
+static int decrementC(CPUInstructionParameters)
 {
 	decrement(cpu, cpu->C());
+	return 4;
 }
 
-static void loadValueIntoC(CPUInstructionParameters)
+static int loadValueIntoC(CPUInstructionParameters)
 {
-	cpu->C() = read(cpu, bus);
+	cpu->C() = static_cast<uint8_t>(operand);
+	return 8;
 }
 
-static void rotateARight(CPUInstructionParameters)
+static int rotateARight(CPUInstructionParameters)
 {
 	rotateRight(cpu, cpu->A());
+	return 4;
 }
 
-static void stop(CPUInstructionParameters)
+static int stop(CPUInstructionParameters)
 {
 	// TODO what is done at stop ???
 	//cpu->stop();
 	bus->resetTimerDivider();
+	return 0;
 }
 
-static void loadTwoBytesIntoDE(CPUInstructionParameters)
+static int loadTwoBytesIntoDE(CPUInstructionParameters)
 {
-	cpu->DE() = readTwoBytes(cpu, bus);
+	cpu->DE() = operand;
+	return 12;
 }
 
-static void writeAToAddressDE(CPUInstructionParameters)
+static int writeAToAddressDE(CPUInstructionParameters)
 {
 	bus->write(cpu->DE(), cpu->A());
+	return 8;
 }
 
-static void incrementDE(CPUInstructionParameters)
+static int incrementDE(CPUInstructionParameters)
 {
 	++cpu->DE();
+	return 8;
 }
 
-static void incrementD(CPUInstructionParameters)
+static int incrementD(CPUInstructionParameters)
 {
 	increment(cpu, cpu->D());
+	return 4;
 }
 
-static void decrementD(CPUInstructionParameters)
+static int decrementD(CPUInstructionParameters)
 {
 	decrement(cpu, cpu->D());
+	return 4;
 }
 
-static void loadValueIntoD(CPUInstructionParameters)
+static int loadValueIntoD(CPUInstructionParameters)
 {
-	cpu->D() = read(cpu, bus);
+	cpu->D() = static_cast<uint8_t>(operand);
+	return 8;
 }
 
-static void rotateALeftThroughCarry(CPUInstructionParameters)
+static int rotateALeftThroughCarry(CPUInstructionParameters)
 {
 	rotateLeftThroughCarry(cpu, cpu->A());
+	return 4;
 }
 
-static void jumpRealativeToValue(CPUInstructionParameters)
+static int jumpRealativeToValue(CPUInstructionParameters)
 {
-	cpu->InstructionPointer() += readSigned(cpu, bus);
+	cpu->InstructionPointer() += static_cast<int8_t>(operand);
+	return 12;
 }
 
-static void addDEToHL(CPUInstructionParameters)
+static int addDEToHL(CPUInstructionParameters)
 {
 	add(cpu, cpu->HL(), cpu->DE());
+	return 8;
 }
 
-static void loadValuePointedByDEIntoA(CPUInstructionParameters)
+static int loadValuePointedByDEIntoA(CPUInstructionParameters)
 {
 	cpu->A() = bus->read(cpu->DE());
+	return 8;
 }
 
-static void decrementDE(CPUInstructionParameters)
+static int decrementDE(CPUInstructionParameters)
 {
 	--cpu->DE();
+	return 8;
 }
 
-static void incrementE(CPUInstructionParameters)
+static int incrementE(CPUInstructionParameters)
 {
 	increment(cpu, cpu->E());
+	return 4;
 }
 
-static void decrementE(CPUInstructionParameters)
+static int decrementE(CPUInstructionParameters)
 {
 	decrement(cpu, cpu->E());
+	return 4;
 }
 
-static void loadValueIntoE(CPUInstructionParameters)
+static int loadValueIntoE(CPUInstructionParameters)
 {
-	cpu->E() = read(cpu, bus);
+	cpu->E() = static_cast<uint8_t>(operand);
+	return 8;
 }
 
-static void rotateARightThroughCarry(CPUInstructionParameters)
+static int rotateARightThroughCarry(CPUInstructionParameters)
 {
 	rotateRightThroughCarry(cpu, cpu->A());
+	return 4;
 }
 
-static void jumpRelativeNotZeroToValue(CPUInstructionParameters)
+static int jumpRelativeNotZeroToValue(CPUInstructionParameters)
 {
-	auto num = readSigned(cpu, bus);
+	auto num = static_cast<int8_t>(operand);
 	if (!cpu->getZeroFlag()) 
 	{
 		cpu->InstructionPointer() += num;
-		*branchTaken = true;
+		return 12;
 	}
+	return 8;
 }
 
-static void loadTwoBytesIntoHL(CPUInstructionParameters)
+static int loadTwoBytesIntoHL(CPUInstructionParameters)
 {
-	cpu->HL() = readTwoBytes(cpu, bus);
+	cpu->HL() = operand;
+	return 12;
 }
 
-static void loadAIntoHLAddressAndInc(CPUInstructionParameters)
+static int loadAIntoHLAddressAndInc(CPUInstructionParameters)
 {
 	bus->write(cpu->HL()++, cpu->A());
+	return 8;
 }
 
-static void incrementHL(CPUInstructionParameters)
+static int incrementHL(CPUInstructionParameters)
 {
 	++cpu->HL();
+	return 8;
 }
 
-static void incrementH(CPUInstructionParameters)
+static int incrementH(CPUInstructionParameters)
 {
 	increment(cpu, cpu->H());
+	return 4;
 }
 
-static void decrementH(CPUInstructionParameters)
+static int decrementH(CPUInstructionParameters)
 {
 	decrement(cpu, cpu->H());
+	return 4;
 }
 
-static void loadValueIntoH(CPUInstructionParameters)
+static int loadValueIntoH(CPUInstructionParameters)
 {
-	cpu->H() = read(cpu, bus);
+	cpu->H() = static_cast<uint8_t>(operand);
+	return 8;
 }
 
-static void decimalAdjustAccumulator(CPUInstructionParameters)
+static int decimalAdjustAccumulator(CPUInstructionParameters)
 {
 	if (cpu->getSubtractionFlag()) 
 	{
@@ -284,3042 +389,1712 @@ static void decimalAdjustAccumulator(CPUInstructionParameters)
 	}
 	cpu->setZeroFlag(cpu->A() == 0);
 	cpu->setHalfCarryFlag(false);
+	return 4;
 }
 
-static void jumpRealativeZeroToValue(CPUInstructionParameters)
+static int jumpRealativeZeroToValue(CPUInstructionParameters)
 {
-	auto num = readSigned(cpu, bus);
+	auto num = static_cast<int8_t>(operand);
 	if (cpu->getZeroFlag()) 
 	{
 		cpu->InstructionPointer() += num;
-		*branchTaken = true;
+		return 12;
 	}
+	return 8;
 }
 
-static void addHLToHL(CPUInstructionParameters)
+static int addHLToHL(CPUInstructionParameters)
 {
 	add(cpu, cpu->HL(), cpu->HL());
+	return 8;
 }
 
-static void loadHLAddressIntoAIncrementHL(CPUInstructionParameters)
+static int loadHLAddressIntoAIncrementHL(CPUInstructionParameters)
 {
 	cpu->A() = bus->read(cpu->HL()++);
+	return 8;
 }
 
-static void decrementHL(CPUInstructionParameters)
+static int decrementHL(CPUInstructionParameters)
 {
 	--cpu->HL();
+	return 8;
 }
 
-static void incrementL(CPUInstructionParameters)
+static int incrementL(CPUInstructionParameters)
 {
 	increment(cpu, cpu->L());
+	return 4;
 }
 
-static void decrementL(CPUInstructionParameters)
+static int decrementL(CPUInstructionParameters)
 {
 	decrement(cpu, cpu->L());
+	return 4;
 }
 
-static void loadValueIntoL(CPUInstructionParameters)
+static int loadValueIntoL(CPUInstructionParameters)
 {
-	cpu->L() = read(cpu, bus);
+	cpu->L() = static_cast<uint8_t>(operand);
+	return 8;
 }
 
-static void complementAccumulator(CPUInstructionParameters)
+static int complementAccumulator(CPUInstructionParameters)
 {
 	cpu->A() = ~cpu->A();
 	cpu->setSubtractionFlag(true);
 	cpu->setHalfCarryFlag(true);
+	return 4;
 }
 
-static void jumpRelativeNotCarryToValue(CPUInstructionParameters)
+static int jumpRelativeNotCarryToValue(CPUInstructionParameters)
 {
-	auto num = readSigned(cpu, bus);
+	auto num = static_cast<int8_t>(operand);
 	if (!cpu->getCarryFlag()) 
 	{
 		cpu->InstructionPointer() += num;
-		*branchTaken = true;
+		return 12;
 	}
+	return 8;
 }
 
-static void loadTwoBytesIntoStackPointer(CPUInstructionParameters)
+static int loadTwoBytesIntoStackPointer(CPUInstructionParameters)
 {
-	cpu->StackPointer() = readTwoBytes(cpu, bus);
+	cpu->StackPointer() = operand;
+	return 12;
 }
 
-static void loadAIntoHLAddressAndDec(CPUInstructionParameters)
+static int loadAIntoHLAddressAndDec(CPUInstructionParameters)
 {
 	bus->write(cpu->HL()--, cpu->A());
+	return 8;
 }
 
-static void incrementSP(CPUInstructionParameters)
+static int incrementSP(CPUInstructionParameters)
 {
 	++cpu->StackPointer();
+	return 8;
 }
 
-static void incrementAddressHL(CPUInstructionParameters)
+static int incrementAddressHL(CPUInstructionParameters)
 {
 	auto val = bus->read(cpu->HL());
 	increment(cpu, val);
 	bus->write(cpu->HL(), val);
+	return 12;
 }
 
-static void decrementAddressHL(CPUInstructionParameters)
+static int decrementAddressHL(CPUInstructionParameters)
 {
 	auto val = bus->read(cpu->HL());
 	decrement(cpu, val);
 	bus->write(cpu->HL(), val);
+	return 12;
 }
 
-static void loadValueIntoAddressHL(CPUInstructionParameters)
+static int loadValueIntoAddressHL(CPUInstructionParameters)
 {
-	auto val = read(cpu, bus);
+	auto val = static_cast<uint8_t>(operand);
 	bus->write(cpu->HL(), val);
+	return 12;
 }
 
-static void setCarryFlag(CPUInstructionParameters)
+static int setCarryFlag(CPUInstructionParameters)
 {
 	cpu->setCarryFlag(true);
 	cpu->setHalfCarryFlag(false);
 	cpu->setSubtractionFlag(false);
+	return 4;
 }
 
-static void jumpRealativeCarryToValue(CPUInstructionParameters)
+static int jumpRealativeCarryToValue(CPUInstructionParameters)
 {
-	auto num = readSigned(cpu, bus);
+	auto num = static_cast<int8_t>(operand);
 	if (cpu->getCarryFlag()) 
 	{
 		cpu->InstructionPointer() += num;
-		*branchTaken = true;
+		return 12;
 	}
+	return 8;
 }
 
-static void addSPToHL(CPUInstructionParameters)
+static int addSPToHL(CPUInstructionParameters)
 {
 	add(cpu, cpu->HL(), cpu->StackPointer());
+	return 8;
 }
 
-static void loadHLAddressIntoADecrementHL(CPUInstructionParameters)
+static int loadHLAddressIntoADecrementHL(CPUInstructionParameters)
 {
 	cpu->A() = bus->read(cpu->HL()--);
+	return 8;
 }
 
-static void decrementSP(CPUInstructionParameters)
+static int decrementSP(CPUInstructionParameters)
 {
 	--cpu->StackPointer();
+	return 8;
 }
 
-static void incrementA(CPUInstructionParameters)
+static int incrementA(CPUInstructionParameters)
 {
 	increment(cpu, cpu->A());
+	return 4;
 }
 
-static void decrementA(CPUInstructionParameters)
+static int decrementA(CPUInstructionParameters)
 {
 	decrement(cpu, cpu->A());
+	return 4;
 }
 
-static void loadValueIntoA(CPUInstructionParameters)
+static int loadValueIntoA(CPUInstructionParameters)
 {
-	cpu->A() = read(cpu, bus);
+	cpu->A() = static_cast<uint8_t>(operand);
+	return 8;
 }
 
-static void complementCarryFlag(CPUInstructionParameters)
+static int complementCarryFlag(CPUInstructionParameters)
 {
 	cpu->setCarryFlag(!cpu->getCarryFlag());
 	cpu->setSubtractionFlag(false);
 	cpu->setHalfCarryFlag(false);
+	return 4;
 }
 
-static void loadBIntoB(CPUInstructionParameters)
+// LD r,r' (0x40 - 0x7F without HALT)
+template <int Destination, int Source>
+static int load(CPUInstructionParameters)
 {
-	cpu->B() = cpu->B();
+	static_assert(Destination != REGISTER_HL_ADDRESS || Source != REGISTER_HL_ADDRESS, "0x76 is HALT");
+	writeRegister<Destination>(cpu, bus, readRegister<Source>(cpu, bus));
+	return registerCycles<Destination>(registerCycles<Source>(4));
 }
 
-static void loadCIntoB(CPUInstructionParameters)
+static int halt(CPUInstructionParameters)
 {
-	cpu->B() = cpu->C();
-}
-
-static void loadDIntoB(CPUInstructionParameters)
+	// TODO handle halt bug
+	cpu->stop();
+	return 0;
+}
+
+enum class ArithmeticOperation
+{
+	ADD,
+	ADD_WITH_CARRY,
+	SUBTRACT,
+	SUBTRACT_WITH_CARRY,
+	AND,
+	XOR,
+	OR,
+	COMPARE,
+};
+
+// ADD / ADC / SUB / SBC / AND / XOR / OR / CP A,r (0x80 - 0xBF)
+template <ArithmeticOperation Operation, int Source>
+static int arithmetic(CPUInstructionParameters)
+{
+	const uint8_t value = readRegister<Source>(cpu, bus);
+	if constexpr (Operation == ArithmeticOperation::ADD)
+		add(cpu, cpu->A(), value);
+	else if constexpr (Operation == ArithmeticOperation::ADD_WITH_CARRY)
+		add(cpu, cpu->A(), value, cpu->getCarryFlag());
+	else if constexpr (Operation == ArithmeticOperation::SUBTRACT)
+		sub(cpu, cpu->A(), value);
+	else if constexpr (Operation == ArithmeticOperation::SUBTRACT_WITH_CARRY)
+		sub(cpu, cpu->A(), value, cpu->getCarryFlag());
+	else if constexpr (Operation == ArithmeticOperation::AND)
+		bitwiseAnd(cpu, cpu->A(), value);
+	else if constexpr (Operation == ArithmeticOperation::XOR)
+		bitwiseXOR(cpu, cpu->A(), value);
+	else if constexpr (Operation == ArithmeticOperation::OR)
+		bitwiseOR(cpu, cpu->A(), value);
+	else
+		compare(cpu, cpu->A(), value);
+	return registerCycles<Source>(4);
+}
+
+static int returnNotZero(CPUInstructionParameters)
 {
-	cpu->B() = cpu->D();
+	if (!cpu->getZeroFlag()) 
+	{
+		cpu->InstructionPointer() = popFromStack(cpu, bus); 
+		return 20;
+	}
+	return 8;
 }
 
-static void loadEIntoB(CPUInstructionParameters)
+static int popBC(CPUInstructionParameters)
 {
-	cpu->B() = cpu->E();
+	cpu->BC() = popFromStack(cpu, bus);
+	return 12;
 }
 
-static void loadHIntoB(CPUInstructionParameters)
+static int jumpNotZeroToNumber(CPUInstructionParameters)
 {
-	cpu->B() = cpu->H();
+	const uint16_t bytes = operand;
+	if (!cpu->getZeroFlag()) 
+	{
+		cpu->InstructionPointer() = bytes;
+		return 16;
+	}
+	return 12;
 }
 
-static void loadLIntoB(CPUInstructionParameters)
+static int jumpToNumber(CPUInstructionParameters)
 {
-	cpu->B() = cpu->L();
+	cpu->InstructionPointer() = operand;
+	return 16;
 }
 
-static void loadAddressHLIntoB(CPUInstructionParameters)
+static void call(CPUState* cpu, BUS* bus, uint16_t address, bool shouldCall)
 {
-	cpu->B() = bus->read(cpu->HL());
-}
+	if (!shouldCall)
+		return;
 
-static void loadAIntoB(CPUInstructionParameters)
-{
-	cpu->B() = cpu->A();
+	callAddress(cpu, bus, address);
 }
 
-static void loadBIntoC(CPUInstructionParameters)
+static int callNotZeroNumber(CPUInstructionParameters)
 {
-	cpu->C() = cpu->B();
+	const bool shouldCall = !cpu->getZeroFlag();
+	call(cpu, bus, operand, shouldCall);
+	return shouldCall ? 24 : 12;
 }
 
-static void loadCIntoC(CPUInstructionParameters)
+static int pushBC(CPUInstructionParameters)
 {
-	cpu->C() = cpu->C();
+	pushOnStack(cpu, bus, cpu->BC());
+	return 16;
 }
 
-static void loadDIntoC(CPUInstructionParameters)
+static int addNumberToA(CPUInstructionParameters)
 {
-	cpu->C() = cpu->D();
+	auto num = static_cast<uint8_t>(operand);
+	add(cpu, cpu->A(), num);
+	return 8;
 }
 
-static void loadEIntoC(CPUInstructionParameters)
+static void restart(CPUState* cpu, BUS* bus, uint16_t address)
 {
-	cpu->C() = cpu->E();
+	pushOnStack(cpu, bus, cpu->InstructionPointer());
+	cpu->InstructionPointer() = address;
 }
 
-static void loadHIntoC(CPUInstructionParameters)
+static int restart00(CPUInstructionParameters)
 {
-	cpu->C() = cpu->H();
+	restart(cpu, bus, 0x00);
+	return 16;
 }
 
-static void loadLIntoC(CPUInstructionParameters)
+static int returnZero(CPUInstructionParameters)
 {
-	cpu->C() = cpu->L();
+	if (cpu->getZeroFlag()) 
+	{
+		cpu->InstructionPointer() = popFromStack(cpu, bus);
+		return 20;
+	}
+	return 8;
 }
 
-static void loadHLAddressIntoC(CPUInstructionParameters)
+static int returnInstr(CPUInstructionParameters)
 {
-	cpu->C() = bus->read(cpu->HL());
+	cpu->InstructionPointer() = popFromStack(cpu, bus);
+	return 16;
 }
 
-static void loadAIntoC(CPUInstructionParameters)
+static int jumpZeroToNumber(CPUInstructionParameters)
 {
-	cpu->C() = cpu->A();
+	const uint16_t bytes = operand;
+	if (cpu->getZeroFlag()) 
+	{
+		cpu->InstructionPointer() = bytes;
+		return 16;
+	}
+	return 12;
 }
 
-static void loadBIntoD(CPUInstructionParameters)
+static int prefixOPCode(CPUInstructionParameters)
 {
-	cpu->D() = cpu->B();
+	assert(!"Should not be reachable");
+	// Will not be executed because we call the corresponding opcode of the extended opcodes
+	return 0;
 }
 
-static void loadCIntoD(CPUInstructionParameters)
+static int callZeroNumber(CPUInstructionParameters)
 {
-	cpu->D() = cpu->C();
+	const bool shouldCall = cpu->getZeroFlag();
+	call(cpu, bus, operand, shouldCall);
+	return shouldCall ? 24 : 12;
 }
 
-static void loadDIntoD(CPUInstructionParameters)
+static int callInstr(CPUInstructionParameters)
 {
-	cpu->D() = cpu->D();
+	call(cpu, bus, operand, true);
+	return 24;
 }
 
-static void loadEIntoD(CPUInstructionParameters)
+static int addNumberAndCarryToA(CPUInstructionParameters)
 {
-	cpu->D() = cpu->E();
+	add(cpu, cpu->A(), static_cast<uint8_t>(operand), cpu->getCarryFlag());
+	return 8;
 }
 
-static void loadHIntoD(CPUInstructionParameters)
+static int restart08(CPUInstructionParameters)
 {
-	cpu->D() = cpu->H();
+	restart(cpu, bus, 0x08);
+	return 16;
 }
 
-static void loadLIntoD(CPUInstructionParameters)
+static int returnNotCarry(CPUInstructionParameters)
 {
-	cpu->D() = cpu->L();
+	if (!cpu->getCarryFlag()) 
+	{
+		cpu->InstructionPointer() = popFromStack(cpu, bus);
+		return 20;
+	}
+	return 8;
 }
 
-static void loadHLAddressIntoD(CPUInstructionParameters)
+static int popDE(CPUInstructionParameters)
 {
-	cpu->D() = bus->read(cpu->HL());
+	cpu->DE() = popFromStack(cpu, bus);
+	return 12;
 }
 
-static void loadAIntoD(CPUInstructionParameters)
+static int jumpNotCarryToNumber(CPUInstructionParameters)
 {
-	cpu->D() = cpu->A();
+	const uint16_t bytes = operand;
+	if (!cpu->getCarryFlag()) 
+	{
+		cpu->InstructionPointer() = bytes;
+		return 16;
+	}
+	return 12;
 }
 
-static void loadBIntoE(CPUInstructionParameters)
+static int callNotCarryNumber(CPUInstructionParameters)
 {
-	cpu->E() = cpu->B();
+	const bool shouldCall = !cpu->getCarryFlag();
+	call(cpu, bus, operand, shouldCall);
+	return shouldCall ? 24 : 12;
 }
 
-static void loadCIntoE(CPUInstructionParameters)
+static int pushDE(CPUInstructionParameters)
 {
-	cpu->E() = cpu->C();
+	pushOnStack(cpu, bus, cpu->DE());
+	return 16;
 }
 
-static void loadDIntoE(CPUInstructionParameters)
+static int subNumberFromA(CPUInstructionParameters)
 {
-	cpu->E() = cpu->D();
+	auto num = static_cast<uint8_t>(operand);
+	sub(cpu, cpu->A(), num);
+	return 8;
 }
 
-static void loadEIntoE(CPUInstructionParameters)
+static int restart10(CPUInstructionParameters)
 {
-	cpu->E() = cpu->E();
+	restart(cpu, bus, 0x10);
+	return 16;
 }
 
-static void loadHIntoE(CPUInstructionParameters)
+static int returnCarry(CPUInstructionParameters)
 {
-	cpu->E() = cpu->H();
+	if (cpu->getCarryFlag()) 
+	{
+		cpu->InstructionPointer() = popFromStack(cpu, bus);
+		return 20;
+	}
+	return 8;
 }
 
-static void loadLIntoE(CPUInstructionParameters)
+static int enableInterrupts(CPUInstructionParameters)
 {
-	cpu->E() = cpu->L();
+	cpu->enableInterrupts();
+	return 4;
 }
 
-static void loadAddressHLIntoE(CPUInstructionParameters)
+static int returnFromInterruptHandler(CPUInstructionParameters)
 {
-	cpu->E() = bus->read(cpu->HL());
+	cpu->enableInterrupts();
+	return returnInstr(cpu, bus, operand);
 }
 
-static void loadAIntoE(CPUInstructionParameters)
+static int jumpCarryToNumber(CPUInstructionParameters)
 {
-	cpu->E() = cpu->A();
+	const uint16_t bytes = operand;
+	if (cpu->getCarryFlag()) 
+	{
+		cpu->InstructionPointer() = bytes;
+		return 16;
+	}
+	return 12;
 }
 
-static void loadBIntoH(CPUInstructionParameters)
+static int callCarryNumber(CPUInstructionParameters)
 {
-	cpu->H() = cpu->B();
+	const bool shouldCall = cpu->getCarryFlag();
+	call(cpu, bus, operand, shouldCall);
+	return shouldCall ? 24 : 12;
 }
 
-static void loadCIntoH(CPUInstructionParameters)
+static int subtractNumberAndCarryFromA(CPUInstructionParameters)
 {
-	cpu->H() = cpu->C();
+	sub(cpu, cpu->A(), static_cast<uint8_t>(operand), cpu->getCarryFlag());
+	return 8;
 }
 
-static void loadDIntoH(CPUInstructionParameters)
+static int restart18(CPUInstructionParameters)
 {
-	cpu->H() = cpu->D();
+	restart(cpu, bus, 0x18);
+	return 16;
 }
 
-static void loadEIntoH(CPUInstructionParameters)
+static int loadAIntoSpecialAddressPlusNumber(CPUInstructionParameters)
 {
-	cpu->H() = cpu->E();
+	auto num = static_cast<uint8_t>(operand);
+	bus->write(0xFF00 + num, cpu->A());
+	return 12;
 }
 
-static void loadHIntoH(CPUInstructionParameters)
+static int POPHL(CPUInstructionParameters)
 {
-	cpu->H() = cpu->H();
+	cpu->HL() = popFromStack(cpu, bus);
+	return 12;
 }
 
-static void loadLIntoH(CPUInstructionParameters)
+static int loadAIntoSpecialAddressPlusC(CPUInstructionParameters)
 {
-	cpu->H() = cpu->L();
+	bus->write(0xFF00 + cpu->C(), cpu->A());
+	return 8;
 }
 
-static void loadAddressHLIntoH(CPUInstructionParameters)
+static int pushHL(CPUInstructionParameters)
 {
-	cpu->H() = bus->read(cpu->HL());
+	pushOnStack(cpu, bus, cpu->HL());
+	return 16;
 }
 
-static void loadAIntoH(CPUInstructionParameters)
+static int bitwiseAndAAndNumber(CPUInstructionParameters)
 {
-	cpu->H() = cpu->A();
+	auto num = static_cast<uint8_t>(operand);
+	bitwiseAnd(cpu, cpu->A(), num);
+	return 8;
 }
 
-static void loadBIntoL(CPUInstructionParameters)
+static int restart20(CPUInstructionParameters)
 {
-	cpu->L() = cpu->B();
+	restart(cpu, bus, 0x20);
+	return 16;
 }
 
-static void loadCIntoL(CPUInstructionParameters)
+static int addNumberToStackPointer(CPUInstructionParameters)
 {
-	cpu->L() = cpu->C();
+	add(cpu, cpu->StackPointer(), static_cast<int8_t>(operand));
+	return 16;
 }
 
-static void loadDIntoL(CPUInstructionParameters)
+static int jumpToHL(CPUInstructionParameters)
 {
-	cpu->L() = cpu->D();
+	cpu->InstructionPointer() = cpu->HL();
+	return 4;
 }
 
-static void loadEIntoL(CPUInstructionParameters)
+static int loadAIntoNumberAddress(CPUInstructionParameters)
 {
-	cpu->L() = cpu->E();
+	auto address = operand;
+	bus->write(address, cpu->A());
+	return 16;
 }
 
-static void loadHIntoL(CPUInstructionParameters)
+static int xorAAndNumber(CPUInstructionParameters)
 {
-	cpu->L() = cpu->H();
+	auto num = static_cast<uint8_t>(operand);
+	bitwiseXOR(cpu, cpu->A(), num);
+	return 8;
 }
 
-static void loadLIntoL(CPUInstructionParameters)
+static int restart28(CPUInstructionParameters)
 {
-	cpu->L() = cpu->L();
+	restart(cpu, bus, 0x28);
+	return 16;
 }
 
-static void loadAddressHLIntoL(CPUInstructionParameters)
+static int loadSpecialAddressPlusNumberIntoA(CPUInstructionParameters)
 {
-	cpu->L() = bus->read(cpu->HL());
+	auto num = static_cast<uint8_t>(operand);
+	cpu->A() = bus->read(0xFF00 + num);
+	return 12;
 }
 
-static void loadAIntoL(CPUInstructionParameters)
+static int POPAF(CPUInstructionParameters)
 {
-	cpu->L() = cpu->A();
+	cpu->AF() = popFromStack(cpu, bus);
+	cpu->F() &= 0xF0;
+	return 12;
 }
 
-static void loadBIntoHLAddress(CPUInstructionParameters)
+static int loadSpecialAddressPlusCIntoA(CPUInstructionParameters)
 {
-	bus->write(cpu->HL(), cpu->B());
+	cpu->A() = bus->read(0xFF00 + cpu->C());
+	return 8;
 }
 
-static void loadCIntoHLAddress(CPUInstructionParameters)
+static int disableInterrupts(CPUInstructionParameters)
 {
-	bus->write(cpu->HL(), cpu->C());
+	cpu->disableInterrupts();
+	return 4;
 }
 
-static void loadDIntoHLAddress(CPUInstructionParameters)
+static int pushAF(CPUInstructionParameters)
 {
-	bus->write(cpu->HL(), cpu->D());
+	pushOnStack(cpu, bus, cpu->AF());
+	return 16;
 }
 
-static void loadEIntoHLAddress(CPUInstructionParameters)
+static int bitwiseOrAAndNumber(CPUInstructionParameters)
 {
-	bus->write(cpu->HL(), cpu->E());
+	auto num = static_cast<uint8_t>(operand);
+	bitwiseOR(cpu, cpu->A(), num);
+	return 8;
 }
 
-static void loadHIntoHLAddress(CPUInstructionParameters)
+static int restart30(CPUInstructionParameters)
 {
-	bus->write(cpu->HL(), cpu->H());
+	restart(cpu, bus, 0x30);
+	return 16;
 }
 
-static void loadLIntoHLAddress(CPUInstructionParameters)
+static int loadStackPointerPlusNumberIntoHL(CPUInstructionParameters)
 {
-	bus->write(cpu->HL(), cpu->L());
+	auto sp = cpu->StackPointer();
+	const auto signedVal = static_cast<int8_t>(operand);
+	add(cpu, sp, signedVal);
+	cpu->HL() = sp;
+	return 12;
 }
 
-static void halt(CPUInstructionParameters)
+static int loadHLIntoStackPointer(CPUInstructionParameters)
 {
-	// TODO handle halt bug
-	cpu->stop();
+	cpu->StackPointer() = cpu->HL();
+	return 8;
 }
 
-static void loadAIntoHLAddress(CPUInstructionParameters)
+static int loadAddressIntoA(CPUInstructionParameters)
 {
-	bus->write(cpu->HL(), cpu->A());
+	auto address = operand;
+	cpu->A() = bus->read(address);
+	return 16;
 }
 
-static void loadBIntoA(CPUInstructionParameters)
+static int compareAWithNumber(CPUInstructionParameters)
 {
-	cpu->A() = cpu->B();
+	auto num = static_cast<uint8_t>(operand);
+	compare(cpu, cpu->A(), num);
+	return 8;
 }
 
-static void loadCIntoA(CPUInstructionParameters)
+static int restart38(CPUInstructionParameters)
 {
-	cpu->A() = cpu->C();
+	restart(cpu, bus, 0x38);
+	return 16;
 }
 
-static void loadDIntoA(CPUInstructionParameters)
+static int rotateBLeft(CPUInstructionParameters)
 {
-	cpu->A() = cpu->D();
+	rotateLeftSetZero(cpu, cpu->B());
+	return 8;
 }
 
-static void loadEIntoA(CPUInstructionParameters)
+static int rotateCLeft(CPUInstructionParameters)
 {
-	cpu->A() = cpu->E();
+	rotateLeftSetZero(cpu, cpu->C());
+	return 8;
 }
 
-static void loadHIntoA(CPUInstructionParameters)
+static int rotateDLeft(CPUInstructionParameters)
 {
-	cpu->A() = cpu->H();
+	rotateLeftSetZero(cpu, cpu->D());
+	return 8;
 }
 
-static void loadLIntoA(CPUInstructionParameters)
+static int rotateELeft(CPUInstructionParameters)
 {
-	cpu->A() = cpu->L();
+	rotateLeftSetZero(cpu, cpu->E());
+	return 8;
 }
 
-static void loadAddressHLIntoA(CPUInstructionParameters)
+static int rotateHLeft(CPUInstructionParameters)
 {
-	cpu->A() = bus->read(cpu->HL());
+	rotateLeftSetZero(cpu, cpu->H());
+	return 8;
 }
 
-static void loadAIntoA(CPUInstructionParameters)
+static int rotateLLeft(CPUInstructionParameters)
 {
-	cpu->A() = cpu->A();
+	rotateLeftSetZero(cpu, cpu->L());
+	return 8;
 }
 
-static void addBToA(CPUInstructionParameters)
+static int rotateHLAddressLeft(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->B());
+	auto val = bus->read(cpu->HL());
+	rotateLeftSetZero(cpu, val);
+	bus->write(cpu->HL(), val);
+	return 16;
 }
 
-static void addCToA(CPUInstructionParameters)
+static int rotateALeftSetZero(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->C());
+	rotateLeftSetZero(cpu, cpu->A());
+	return 8;
 }
 
-static void addDToA(CPUInstructionParameters)
+static int rotateBRight(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->D());
+	rotateRightSetZero(cpu, cpu->B());
+	return 8;
 }
 
-static void addEToA(CPUInstructionParameters)
+static int rotateCRight(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->E());
+	rotateRightSetZero(cpu, cpu->C());
+	return 8;
 }
 
-static void addHToA(CPUInstructionParameters)
+static int rotateDRight(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->H());
+	rotateRightSetZero(cpu, cpu->D());
+	return 8;
 }
 
-static void addLToA(CPUInstructionParameters)
+static int rotateERight(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->L());
+	rotateRightSetZero(cpu, cpu->E());
+	return 8;
 }
 
-static void addHLAddressToA(CPUInstructionParameters)
+static int rotateHRight(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), bus->read(cpu->HL()));
+	rotateRightSetZero(cpu, cpu->H());
+	return 8;
 }
 
-static void addAToA(CPUInstructionParameters)
+static int rotateLRight(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->A());
+	rotateRightSetZero(cpu, cpu->L());
+	return 8;
 }
 
-static void addBAndCarryToA(CPUInstructionParameters)
+static int rotateHLAddressRight(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->B(), cpu->getCarryFlag());
+	auto val = bus->read(cpu->HL());
+	rotateRightSetZero(cpu, val);
+	bus->write(cpu->HL(), val);
+	return 16;
 }
 
-static void addCAndCarryToA(CPUInstructionParameters)
+static int rotateARightSetZero(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->C(), cpu->getCarryFlag());
+	rotateRightSetZero(cpu, cpu->A());
+	return 8;
 }
 
-static void addDAndCarryToA(CPUInstructionParameters)
+static int rotateBRightThroughCarry(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->D(), cpu->getCarryFlag());
+	rotateRightThroughCarrySetZero(cpu, cpu->B());
+	return 8;
 }
 
-static void addEAndCarryToA(CPUInstructionParameters)
+static int rotateCRightThroughCarry(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->E(), cpu->getCarryFlag());
+	rotateRightThroughCarrySetZero(cpu, cpu->C());
+	return 8;
 }
 
-static void addHAndCarryToA(CPUInstructionParameters)
+static int rotateDRightThroughCarry(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->H(), cpu->getCarryFlag());
+	rotateRightThroughCarrySetZero(cpu, cpu->D());
+	return 8;
 }
 
-static void addLAndCarryToA(CPUInstructionParameters)
+static int rotateERightThroughCarry(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->L(), cpu->getCarryFlag());
+	rotateRightThroughCarrySetZero(cpu, cpu->E());
+	return 8;
 }
 
-static void addHLAddressAndCarryToA(CPUInstructionParameters)
+static int rotateHRightThroughCarry(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), bus->read(cpu->HL()), cpu->getCarryFlag());
+	rotateRightThroughCarrySetZero(cpu, cpu->H());
+	return 8;
 }
 
-static void addAAndCarryToA(CPUInstructionParameters)
+static int rotateLRightThroughCarry(CPUInstructionParameters)
 {
-	add(cpu, cpu->A(), cpu->A(), cpu->getCarryFlag());
+	rotateRightThroughCarrySetZero(cpu, cpu->L());
+	return 8;
 }
 
-static void subBFromA(CPUInstructionParameters)
+static int rotateHLAddressRightThroughCarry(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->B());
+	auto val = bus->read(cpu->HL());
+	rotateRightThroughCarrySetZero(cpu, val);
+	bus->write(cpu->HL(), val);
+	return 16;
 }
 
-static void subCFromA(CPUInstructionParameters)
+static int rotateARightThroughCarrySetZero(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->C());
+	rotateRightThroughCarrySetZero(cpu, cpu->A());
+	return 8;
 }
 
-static void subDFromA(CPUInstructionParameters)
+static int rotateBLeftThroughCarry(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->D());
+	rotateLeftThroughCarrySetZero(cpu, cpu->B());
+	return 8;
 }
 
-static void subEFromA(CPUInstructionParameters)
+static int rotateCLeftThroughCarry(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->E());
+	rotateLeftThroughCarrySetZero(cpu, cpu->C());
+	return 8;
 }
 
-static void subHFromA(CPUInstructionParameters)
+static int rotateDLeftThroughCarry(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->H());
+	rotateLeftThroughCarrySetZero(cpu, cpu->D());
+	return 8;
 }
 
-static void subLFromA(CPUInstructionParameters)
+static int rotateELeftThroughCarry(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->L());
+	rotateLeftThroughCarrySetZero(cpu, cpu->E());
+	return 8;
 }
 
-static void subHLAddressFromA(CPUInstructionParameters)
+static int rotateHLeftThroughCarry(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), bus->read(cpu->HL()));
+	rotateLeftThroughCarrySetZero(cpu, cpu->H());
+	return 8;
 }
 
-static void subAFromA(CPUInstructionParameters)
+static int rotateLLeftThroughCarry(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->A());
+	rotateLeftThroughCarrySetZero(cpu, cpu->L());
+	return 8;
 }
 
-static void subBAndCarryFromA(CPUInstructionParameters)
+static int rotateHLAddressLeftThroughCarry(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->B(), cpu->getCarryFlag());
+	auto val = bus->read(cpu->HL());
+	rotateLeftThroughCarrySetZero(cpu, val);
+	bus->write(cpu->HL(), val);
+	return 16;
 }
 
-static void subCAndCarryFromA(CPUInstructionParameters)
+static int rotateALeftThroughCarrySetZero(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->C(), cpu->getCarryFlag());
+	rotateLeftThroughCarrySetZero(cpu, cpu->A());
+	return 8;
 }
 
-static void subDAndCarryFromA(CPUInstructionParameters)
+static int shiftBLeftArithmetically(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->D(), cpu->getCarryFlag());
+	shiftLeftArithmetically(cpu, cpu->B());
+	return 8;
 }
 
-static void subEAndCarryFromA(CPUInstructionParameters)
+static int shiftCLeftArithmetically(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->E(), cpu->getCarryFlag());
+	shiftLeftArithmetically(cpu, cpu->C());
+	return 8;
 }
 
-static void subHAndCarryFromA(CPUInstructionParameters)
+static int shiftDLeftArithmetically(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->H(), cpu->getCarryFlag());
+	shiftLeftArithmetically(cpu, cpu->D());
+	return 8;
 }
 
-static void subLAndCarryFromA(CPUInstructionParameters)
+static int shiftELeftArithmetically(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->L(), cpu->getCarryFlag());
+	shiftLeftArithmetically(cpu, cpu->E());
+	return 8;
 }
 
-static void subHLAddressAndCarryFromA(CPUInstructionParameters)
+static int shiftHLeftArithmetically(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), bus->read(cpu->HL()), cpu->getCarryFlag());
+	shiftLeftArithmetically(cpu, cpu->H());
+	return 8;
 }
 
-static void subAAndCarryFromA(CPUInstructionParameters)
+static int shiftLLeftArithmetically(CPUInstructionParameters)
 {
-	sub(cpu, cpu->A(), cpu->A(), cpu->getCarryFlag());
+	shiftLeftArithmetically(cpu, cpu->L());
+	return 8;
 }
 
-static void bitwiseAndAAndB(CPUInstructionParameters)
+static int shiftHLAddressLeftArithmetically(CPUInstructionParameters)
 {
-	bitwiseAnd(cpu, cpu->A(), cpu->B());
+	auto val = bus->read(cpu->HL());
+	shiftLeftArithmetically(cpu, val);
+	bus->write(cpu->HL(), val);
+	return 16;
 }
 
-static void bitwiseAndAAndC(CPUInstructionParameters)
+static int shiftALeftArithmetically(CPUInstructionParameters)
 {
-	bitwiseAnd(cpu, cpu->A(), cpu->C());
+	shiftLeftArithmetically(cpu, cpu->A());
+	return 8;
 }
 
-static void bitwiseAndAAndD(CPUInstructionParameters)
+static int shiftBRightArithmetically(CPUInstructionParameters)
 {
-	bitwiseAnd(cpu, cpu->A(), cpu->D());
+	shiftRightArithmetically(cpu, cpu->B());
+	return 8;
 }
 
-static void bitwiseAndAAndE(CPUInstructionParameters)
+static int shiftCRightArithmetically(CPUInstructionParameters)
 {
-	bitwiseAnd(cpu, cpu->A(), cpu->E());
+	shiftRightArithmetically(cpu, cpu->C());
+	return 8;
 }
 
-static void bitwiseAndAAndH(CPUInstructionParameters)
+static int shiftDRightArithmetically(CPUInstructionParameters)
 {
-	bitwiseAnd(cpu, cpu->A(), cpu->H());
+	shiftRightArithmetically(cpu, cpu->D());
+	return 8;
 }
 
-static void bitwiseAndAAndL(CPUInstructionParameters)
+static int shiftERightArithmetically(CPUInstructionParameters)
 {
-	bitwiseAnd(cpu, cpu->A(), cpu->L());
+	shiftRightArithmetically(cpu, cpu->E());
+	return 8;
 }
 
-static void bitwiseAndAAndHLAddress(CPUInstructionParameters)
+static int shiftHRightArithmetically(CPUInstructionParameters)
 {
-	bitwiseAnd(cpu, cpu->A(), bus->read(cpu->HL()));
+	shiftRightArithmetically(cpu, cpu->H());
+	return 8;
 }
 
-static void bitwiseAndAAndA(CPUInstructionParameters)
+static int shiftLRightArithmetically(CPUInstructionParameters)
 {
-	bitwiseAnd(cpu, cpu->A(), cpu->A());
+	shiftRightArithmetically(cpu, cpu->L());
+	return 8;
 }
 
-static void bitwiseXORAAndB(CPUInstructionParameters)
+static int shiftHLAddressRightArithmetically(CPUInstructionParameters)
 {
-	bitwiseXOR(cpu, cpu->A(), cpu->B());
+	auto val = bus->read(cpu->HL());
+	shiftRightArithmetically(cpu, val);
+	bus->write(cpu->HL(), val);
+	return 16;
 }
 
-static void bitwiseXORAAndC(CPUInstructionParameters)
+static int shiftARightArithmetically(CPUInstructionParameters)
 {
-	bitwiseXOR(cpu, cpu->A(), cpu->C());
+	shiftRightArithmetically(cpu, cpu->A());
+	return 8;
 }
 
-static void bitwiseXORAAndD(CPUInstructionParameters)
-{
-	bitwiseXOR(cpu, cpu->A(), cpu->D());
-}
 
-static void bitwiseXORAAndE(CPUInstructionParameters)
-{
-	bitwiseXOR(cpu, cpu->A(), cpu->E());
-}
 
-static void bitwiseXORAAndH(CPUInstructionParameters)
-{
-	bitwiseXOR(cpu, cpu->A(), cpu->H());
-}
 
-static void bitwiseXORAAndL(CPUInstructionParameters)
+static int swapB(CPUInstructionParameters)
 {
-	bitwiseXOR(cpu, cpu->A(), cpu->L());
+	swap(cpu, cpu->B());
+	return 8;
 }
 
-static void bitwiseXORAAndHLAddress(CPUInstructionParameters)
+static int swapC(CPUInstructionParameters)
 {
-	bitwiseXOR(cpu, cpu->A(), bus->read(cpu->HL()));
+	swap(cpu, cpu->C());
+	return 8;
 }
 
-static void bitwiseXORAAndA(CPUInstructionParameters)
+static int swapD(CPUInstructionParameters)
 {
-	bitwiseXOR(cpu, cpu->A(), cpu->A());
+	swap(cpu, cpu->D());
+	return 8;
 }
 
-static void bitwiseORAAndB(CPUInstructionParameters)
+static int swapE(CPUInstructionParameters)
 {
-	bitwiseOR(cpu, cpu->A(), cpu->B());
+	swap(cpu, cpu->E());
+	return 8;
 }
 
-static void bitwiseORAAndC(CPUInstructionParameters)
+static int swapH(CPUInstructionParameters)
 {
-	bitwiseOR(cpu, cpu->A(), cpu->C());
+	swap(cpu, cpu->H());
+	return 8;
 }
 
-static void bitwiseORAAndD(CPUInstructionParameters)
+static int swapL(CPUInstructionParameters)
 {
-	bitwiseOR(cpu, cpu->A(), cpu->D());
+	swap(cpu, cpu->L());
+	return 8;
 }
 
-static void bitwiseORAAndE(CPUInstructionParameters)
+static int swapHLAddress(CPUInstructionParameters)
 {
-	bitwiseOR(cpu, cpu->A(), cpu->E());
+	auto val = bus->read(cpu->HL());
+	swap(cpu, val);
+	bus->write(cpu->HL(), val);
+	return 16;
 }
 
-static void bitwiseORAAndH(CPUInstructionParameters)
+static int swapA(CPUInstructionParameters)
 {
-	bitwiseOR(cpu, cpu->A(), cpu->H());
+	swap(cpu, cpu->A());
+	return 8;
 }
 
-static void bitwiseORAAndL(CPUInstructionParameters)
+static int shiftBRightLogically(CPUInstructionParameters)
 {
-	bitwiseOR(cpu, cpu->A(), cpu->L());
+	shiftRightLogically(cpu, cpu->B());
+	return 8;
 }
 
-static void bitwiseORAAndHLAddress(CPUInstructionParameters)
+static int shiftCRightLogically(CPUInstructionParameters)
 {
-	bitwiseOR(cpu, cpu->A(), bus->read(cpu->HL()));
+	shiftRightLogically(cpu, cpu->C());
+	return 8;
 }
 
-static void bitwiseORAAndA(CPUInstructionParameters)
+static int shiftDRightLogically(CPUInstructionParameters)
 {
-	bitwiseOR(cpu, cpu->A(), cpu->A());
+	shiftRightLogically(cpu, cpu->D());
+	return 8;
 }
 
-static void compareAAndB(CPUInstructionParameters)
+static int shiftERightLogically(CPUInstructionParameters)
 {
-	compare(cpu, cpu->A(), cpu->B());
+	shiftRightLogically(cpu, cpu->E());
+	return 8;
 }
 
-static void compareAAndC(CPUInstructionParameters)
+static int shiftHRightLogically(CPUInstructionParameters)
 {
-	compare(cpu, cpu->A(), cpu->C());
+	shiftRightLogically(cpu, cpu->H());
+	return 8;
 }
 
-static void compareAAndD(CPUInstructionParameters)
+static int shiftLRightLogically(CPUInstructionParameters)
 {
-	compare(cpu, cpu->A(), cpu->D());
+	shiftRightLogically(cpu, cpu->L());
+	return 8;
 }
 
-static void compareAAndE(CPUInstructionParameters)
+static int shiftHLAddressRightLogically(CPUInstructionParameters)
 {
-	compare(cpu, cpu->A(), cpu->E());
+	auto val = bus->read(cpu->HL());
+	shiftRightLogically(cpu, val);
+	bus->write(cpu->HL(), val);
+	return 16;
 }
 
-static void compareAAndH(CPUInstructionParameters)
+static int shiftARightLogically(CPUInstructionParameters)
 {
-	compare(cpu, cpu->A(), cpu->H());
+	shiftRightLogically(cpu, cpu->A());
+	return 8;
 }
 
-static void compareAAndL(CPUInstructionParameters)
+// BIT b,r (0xCB 0x40 - 0x7F)
+template <int Bit, int Register>
+static int bitTest(CPUInstructionParameters)
 {
-	compare(cpu, cpu->A(), cpu->L());
+	checkBit(cpu, readRegister<Register>(cpu, bus), 1 << Bit); // checkBit expects the bit mask
+	return registerCycles<Register>(8);
 }
 
-static void compareAAndHLAddress(CPUInstructionParameters)
+// RES b,r (0xCB 0x80 - 0xBF)
+template <int Bit, int Register>
+static int bitReset(CPUInstructionParameters)
 {
-	compare(cpu, cpu->A(), bus->read(cpu->HL()));
+	auto value = readRegister<Register>(cpu, bus);
+	clearBit<Bit>(value);
+	writeRegister<Register>(cpu, bus, value);
+	return registerCycles<Register>(8, 2);
 }
 
-static void compareAAndA(CPUInstructionParameters)
+// SET b,r (0xCB 0xC0 - 0xFF)
+template <int Bit, int Register>
+static int bitSet(CPUInstructionParameters)
 {
-	compare(cpu, cpu->A(), cpu->A());
+	auto value = readRegister<Register>(cpu, bus);
+	setBit<Bit>(value);
+	writeRegister<Register>(cpu, bus, value);
+	return registerCycles<Register>(8, 2);
 }
 
-static void returnNotZero(CPUInstructionParameters)
-{
-	if (!cpu->getZeroFlag()) 
-	{
-		cpu->InstructionPointer() = popFromStack(cpu, bus); 
-		*branchTaken = true;
-	}
-}
 
-static void popBC(CPUInstructionParameters)
-{
-	cpu->BC() = popFromStack(cpu, bus);
-}
 
-static void jumpNotZeroToNumber(CPUInstructionParameters)
-{
-	const uint16_t bytes = readTwoBytes(cpu, bus);
-	if (!cpu->getZeroFlag()) 
-	{
-		*branchTaken = true;
-		cpu->InstructionPointer() = bytes;
-	}
-}
 
-static void jumpToNumber(CPUInstructionParameters)
-{
-	cpu->InstructionPointer() = readTwoBytes(cpu, bus);
-}
 
-static void call(CPUState* cpu, BUS* bus, bool shouldCall)
-{
-	const auto callAddr = readTwoBytes(cpu, bus);
-	if (!shouldCall)
-		return;
 
-	callAddress(cpu, bus, callAddr);
-}
 
-static void callNotZeroNumber(CPUInstructionParameters)
-{
-	*branchTaken = !cpu->getZeroFlag();
-	call(cpu, bus, *branchTaken);
-}
 
-static void pushBC(CPUInstructionParameters)
-{
-	pushOnStack(cpu, bus, cpu->BC());
-}
 
-static void addNumberToA(CPUInstructionParameters)
-{
-	auto num = read(cpu, bus);
-	add(cpu, cpu->A(), num);
-}
 
-static void restart(CPUState* cpu, BUS* bus, uint16_t address)
+void ggb::callAddress(CPUState* cpu, BUS* bus, uint16_t address)
 {
 	pushOnStack(cpu, bus, cpu->InstructionPointer());
 	cpu->InstructionPointer() = address;
 }
 
-static void restart00(CPUInstructionParameters)
-{
-	restart(cpu, bus, 0x00);
-}
-
-static void returnZero(CPUInstructionParameters)
-{
-	if (cpu->getZeroFlag()) 
+// OPCODE(id, instruction, length in bytes, cycle count, cycle count if the branch is taken, mnemonic)
+// Single source for the lookup tables and the threaded interpreter
+#define GGB_OPCODE_TABLE(OPCODE) \
+	OPCODE(0x00, noop, 1, 4, 0, "NOP") \
+	OPCODE(0x01, loadBCValue, 3, 12, 0, "LD BC,u16") \
+	OPCODE(0x02, writeAToAddressBC, 1, 8, 0, "LD (BC),A") \
+	OPCODE(0x03, incrementBC, 1, 8, 0, "INC BC") \
+	OPCODE(0x04, incrementB, 1, 4, 0, "INC B") \
+	OPCODE(0x05, decrementB, 1, 4, 0, "DEC B") \
+	OPCODE(0x06, loadNumberIntoB, 2, 8, 0, "LD B,u8") \
+	OPCODE(0x07, rotateALeft, 1, 4, 0, "RLCA") \
+	OPCODE(0x08, loadStackPointerIntoAddress, 3, 20, 0, "LD (u16),SP") \
+	OPCODE(0x09, addBCToHL, 1, 8, 0, "ADD HL,BC") \
+	OPCODE(0x0A, loadValuePointedByBCIntoA, 1, 8, 0, "LD A,(BC)") \
+	OPCODE(0x0B, decrementBC, 1, 8, 0, "DEC BC") \
+	OPCODE(0x0C, incrementC, 1, 4, 0, "INC C") \
+	OPCODE(0x0D, decrementC, 1, 4, 0, "DEC C") \
+	OPCODE(0x0E, loadValueIntoC, 2, 8, 0, "LD C,u8") \
+	OPCODE(0x0F, rotateARight, 1, 4, 0, "RRCA") \
+	OPCODE(0x10, stop, 1, 0, 0, "STOP") \
+	OPCODE(0x11, loadTwoBytesIntoDE, 3, 12, 0, "LD DE,u16") \
+	OPCODE(0x12, writeAToAddressDE, 1, 8, 0, "LD (DE),A") \
+	OPCODE(0x13, incrementDE, 1, 8, 0, "INC DE") \
+	OPCODE(0x14, incrementD, 1, 4, 0, "INC D") \
+	OPCODE(0x15, decrementD, 1, 4, 0, "DEC D") \
+	OPCODE(0x16, loadValueIntoD, 2, 8, 0, "LD D,u8") \
+	OPCODE(0x17, rotateALeftThroughCarry, 1, 4, 0, "RLA") \
+	OPCODE(0x18, jumpRealativeToValue, 2, 12, 0, "JR i8") \
+	OPCODE(0x19, addDEToHL, 1, 8, 0, "ADD HL,DE") \
+	OPCODE(0x1A, loadValuePointedByDEIntoA, 1, 8, 0, "LD A,(DE)") \
+	OPCODE(0x1B, decrementDE, 1, 8, 0, "DEC DE") \
+	OPCODE(0x1C, incrementE, 1, 4, 0, "INC E") \
+	OPCODE(0x1D, decrementE, 1, 4, 0, "DEC E") \
+	OPCODE(0x1E, loadValueIntoE, 2, 8, 0, "LD E,u8") \
+	OPCODE(0x1F, rotateARightThroughCarry, 1, 4, 0, "RRA") \
+	OPCODE(0x20, jumpRelativeNotZeroToValue, 2, 8, 12, "JR NZ,i8") \
+	OPCODE(0x21, loadTwoBytesIntoHL, 3, 12, 0, "LD HL,u16") \
+	OPCODE(0x22, loadAIntoHLAddressAndInc, 1, 8, 0, "LD (HL+),A") \
+	OPCODE(0x23, incrementHL, 1, 8, 0, "INC HL") \
+	OPCODE(0x24, incrementH, 1, 4, 0, "INC H") \
+	OPCODE(0x25, decrementH, 1, 4, 0, "DEC H") \
+	OPCODE(0x26, loadValueIntoH, 2, 8, 0, "LD H,u8") \
+	OPCODE(0x27, decimalAdjustAccumulator, 1, 4, 0, "DAA") \
+	OPCODE(0x28, jumpRealativeZeroToValue, 2, 8, 12, "JR Z,i8") \
+	OPCODE(0x29, addHLToHL, 1, 8, 0, "ADD HL,HL") \
+	OPCODE(0x2A, loadHLAddressIntoAIncrementHL, 1, 8, 0, "LD A,(HL+)") \
+	OPCODE(0x2B, decrementHL, 1, 8, 0, "DEC HL") \
+	OPCODE(0x2C, incrementL, 1, 4, 0, "INC L") \
+	OPCODE(0x2D, decrementL, 1, 4, 0, "DEC L") \
+	OPCODE(0x2E, loadValueIntoL, 2, 8, 0, "LD L,u8") \
+	OPCODE(0x2F, complementAccumulator, 1, 4, 0, "CPL") \
+	OPCODE(0x30, jumpRelativeNotCarryToValue, 2, 8, 12, "JR NC,i8") \
+	OPCODE(0x31, loadTwoBytesIntoStackPointer, 3, 12, 0, "LD SP,u16") \
+	OPCODE(0x32, loadAIntoHLAddressAndDec, 1, 8, 0, "LD (HL-),A") \
+	OPCODE(0x33, incrementSP, 1, 8, 0, "INC SP") \
+	OPCODE(0x34, incrementAddressHL, 1, 12, 0, "INC (HL)") \
+	OPCODE(0x35, decrementAddressHL, 1, 12, 0, "DEC (HL)") \
+	OPCODE(0x36, loadValueIntoAddressHL, 2, 12, 0, "LD (HL),u8") \
+	OPCODE(0x37, setCarryFlag, 1, 4, 0, "SCF") \
+	OPCODE(0x38, jumpRealativeCarryToValue, 2, 8, 12, "JR C,i8") \
+	OPCODE(0x39, addSPToHL, 1, 8, 0, "ADD HL,SP") \
+	OPCODE(0x3A, loadHLAddressIntoADecrementHL, 1, 8, 0, "LD A,(HL-)") \
+	OPCODE(0x3B, decrementSP, 1, 8, 0, "DEC SP") \
+	OPCODE(0x3C, incrementA, 1, 4, 0, "INC A") \
+	OPCODE(0x3D, decrementA, 1, 4, 0, "DEC A") \
+	OPCODE(0x3E, loadValueIntoA, 2, 8, 0, "LD A,u8") \
+	OPCODE(0x3F, complementCarryFlag, 1, 4, 0, "CCF") \
+	OPCODE(0x40, (load<REGISTER_B, REGISTER_B>), 1, 4, 0, "LD B,B") \
+	OPCODE(0x41, (load<REGISTER_B, REGISTER_C>), 1, 4, 0, "LD B,C") \
+	OPCODE(0x42, (load<REGISTER_B, REGISTER_D>), 1, 4, 0, "LD B,D") \
+	OPCODE(0x43, (load<REGISTER_B, REGISTER_E>), 1, 4, 0, "LD B,E") \
+	OPCODE(0x44, (load<REGISTER_B, REGISTER_H>), 1, 4, 0, "LD B,H") \
+	OPCODE(0x45, (load<REGISTER_B, REGISTER_L>), 1, 4, 0, "LD B,L") \
+	OPCODE(0x46, (load<REGISTER_B, REGISTER_HL_ADDRESS>), 1, 8, 0, "LD B,(HL)") \
+	OPCODE(0x47, (load<REGISTER_B, REGISTER_A>), 1, 4, 0, "LD B,A") \
+	OPCODE(0x48, (load<REGISTER_C, REGISTER_B>), 1, 4, 0, "LD C,B") \
+	OPCODE(0x49, (load<REGISTER_C, REGISTER_C>), 1, 4, 0, "LD C,C") \
+	OPCODE(0x4A, (load<REGISTER_C, REGISTER_D>), 1, 4, 0, "LD C,D") \
+	OPCODE(0x4B, (load<REGISTER_C, REGISTER_E>), 1, 4, 0, "LD C,E") \
+	OPCODE(0x4C, (load<REGISTER_C, REGISTER_H>), 1, 4, 0, "LD C,H") \
+	OPCODE(0x4D, (load<REGISTER_C, REGISTER_L>), 1, 4, 0, "LD C,L") \
+	OPCODE(0x4E, (load<REGISTER_C, REGISTER_HL_ADDRESS>), 1, 8, 0, "LD C,(HL)") \
+	OPCODE(0x4F, (load<REGISTER_C, REGISTER_A>), 1, 4, 0, "LD C,A") \
+	OPCODE(0x50, (load<REGISTER_D, REGISTER_B>), 1, 4, 0, "LD D,B") \
+	OPCODE(0x51, (load<REGISTER_D, REGISTER_C>), 1, 4, 0, "LD D,C") \
+	OPCODE(0x52, (load<REGISTER_D, REGISTER_D>), 1, 4, 0, "LD D,D") \
+	OPCODE(0x53, (load<REGISTER_D, REGISTER_E>), 1, 4, 0, "LD D,E") \
+	OPCODE(0x54, (load<REGISTER_D, REGISTER_H>), 1, 4, 0, "LD D,H") \
+	OPCODE(0x55, (load<REGISTER_D, REGISTER_L>), 1, 4, 0, "LD D,L") \
+	OPCODE(0x56, (load<REGISTER_D, REGISTER_HL_ADDRESS>), 1, 8, 0, "LD D,(HL)") \
+	OPCODE(0x57, (load<REGISTER_D, REGISTER_A>), 1, 4, 0, "LD D,A") \
+	OPCODE(0x58, (load<REGISTER_E, REGISTER_B>), 1, 4, 0, "LD E,B") \
+	OPCODE(0x59, (load<REGISTER_E, REGISTER_C>), 1, 4, 0, "LD E,C") \
+	OPCODE(0x5A, (load<REGISTER_E, REGISTER_D>), 1, 4, 0, "LD E,D") \
+	OPCODE(0x5B, (load<REGISTER_E, REGISTER_E>), 1, 4, 0, "LD E,E") \
+	OPCODE(0x5C, (load<REGISTER_E, REGISTER_H>), 1, 4, 0, "LD E,H") \
+	OPCODE(0x5D, (load<REGISTER_E, REGISTER_L>), 1, 4, 0, "LD E,L") \
+	OPCODE(0x5E, (load<REGISTER_E, REGISTER_HL_ADDRESS>), 1, 8, 0, "LD E,(HL)") \
+	OPCODE(0x5F, (load<REGISTER_E, REGISTER_A>), 1, 4, 0, "LD E,A") \
+	OPCODE(0x60, (load<REGISTER_H, REGISTER_B>), 1, 4, 0, "LD H,B") \
+	OPCODE(0x61, (load<REGISTER_H, REGISTER_C>), 1, 4, 0, "LD H,C") \
+	OPCODE(0x62, (load<REGISTER_H, REGISTER_D>), 1, 4, 0, "LD H,D") \
+	OPCODE(0x63, (load<REGISTER_H, REGISTER_E>), 1, 4, 0, "LD H,E") \
+	OPCODE(0x64, (load<REGISTER_H, REGISTER_H>), 1, 4, 0, "LD H,H") \
+	OPCODE(0x65, (load<REGISTER_H, REGISTER_L>), 1, 4, 0, "LD H,L") \
+	OPCODE(0x66, (load<REGISTER_H, REGISTER_HL_ADDRESS>), 1, 8, 0, "LD H,(HL)") \
+	OPCODE(0x67, (load<REGISTER_H, REGISTER_A>), 1, 4, 0, "LD H,A") \
+	OPCODE(0x68, (load<REGISTER_L, REGISTER_B>), 1, 4, 0, "LD L,B") \
+	OPCODE(0x69, (load<REGISTER_L, REGISTER_C>), 1, 4, 0, "LD L,C") \
+	OPCODE(0x6A, (load<REGISTER_L, REGISTER_D>), 1, 4, 0, "LD L,D") \
+	OPCODE(0x6B, (load<REGISTER_L, REGISTER_E>), 1, 4, 0, "LD L,E") \
+	OPCODE(0x6C, (load<REGISTER_L, REGISTER_H>), 1, 4, 0, "LD L,H") \
+	OPCODE(0x6D, (load<REGISTER_L, REGISTER_L>), 1, 4, 0, "LD L,L") \
+	OPCODE(0x6E, (load<REGISTER_L, REGISTER_HL_ADDRESS>), 1, 8, 0, "LD L,(HL)") \
+	OPCODE(0x6F, (load<REGISTER_L, REGISTER_A>), 1, 4, 0, "LD L,A") \
+	OPCODE(0x70, (load<REGISTER_HL_ADDRESS, REGISTER_B>), 1, 8, 0, "LD (HL),B") \
+	OPCODE(0x71, (load<REGISTER_HL_ADDRESS, REGISTER_C>), 1, 8, 0, "LD (HL),C") \
+	OPCODE(0x72, (load<REGISTER_HL_ADDRESS, REGISTER_D>), 1, 8, 0, "LD (HL),D") \
+	OPCODE(0x73, (load<REGISTER_HL_ADDRESS, REGISTER_E>), 1, 8, 0, "LD (HL),E") \
+	OPCODE(0x74, (load<REGISTER_HL_ADDRESS, REGISTER_H>), 1, 8, 0, "LD (HL),H") \
+	OPCODE(0x75, (load<REGISTER_HL_ADDRESS, REGISTER_L>), 1, 8, 0, "LD (HL),L") \
+	OPCODE(0x76, halt, 1, 0, 0, "HALT") \
+	OPCODE(0x77, (load<REGISTER_HL_ADDRESS, REGISTER_A>), 1, 8, 0, "LD (HL),A") \
+	OPCODE(0x78, (load<REGISTER_A, REGISTER_B>), 1, 4, 0, "LD A,B") \
+	OPCODE(0x79, (load<REGISTER_A, REGISTER_C>), 1, 4, 0, "LD A,C") \
+	OPCODE(0x7A, (load<REGISTER_A, REGISTER_D>), 1, 4, 0, "LD A,D") \
+	OPCODE(0x7B, (load<REGISTER_A, REGISTER_E>), 1, 4, 0, "LD A,E") \
+	OPCODE(0x7C, (load<REGISTER_A, REGISTER_H>), 1, 4, 0, "LD A,H") \
+	OPCODE(0x7D, (load<REGISTER_A, REGISTER_L>), 1, 4, 0, "LD A,L") \
+	OPCODE(0x7E, (load<REGISTER_A, REGISTER_HL_ADDRESS>), 1, 8, 0, "LD A,(HL)") \
+	OPCODE(0x7F, (load<REGISTER_A, REGISTER_A>), 1, 4, 0, "LD A,A") \
+	OPCODE(0x80, (arithmetic<ArithmeticOperation::ADD, REGISTER_B>), 1, 4, 0, "ADD A,B") \
+	OPCODE(0x81, (arithmetic<ArithmeticOperation::ADD, REGISTER_C>), 1, 4, 0, "ADD A,C") \
+	OPCODE(0x82, (arithmetic<ArithmeticOperation::ADD, REGISTER_D>), 1, 4, 0, "ADD A,D") \
+	OPCODE(0x83, (arithmetic<ArithmeticOperation::ADD, REGISTER_E>), 1, 4, 0, "ADD A,E") \
+	OPCODE(0x84, (arithmetic<ArithmeticOperation::ADD, REGISTER_H>), 1, 4, 0, "ADD A,H") \
+	OPCODE(0x85, (arithmetic<ArithmeticOperation::ADD, REGISTER_L>), 1, 4, 0, "ADD A,L") \
+	OPCODE(0x86, (arithmetic<ArithmeticOperation::ADD, REGISTER_HL_ADDRESS>), 1, 8, 0, "ADD A,(HL)") \
+	OPCODE(0x87, (arithmetic<ArithmeticOperation::ADD, REGISTER_A>), 1, 4, 0, "ADD A,A") \
+	OPCODE(0x88, (arithmetic<ArithmeticOperation::ADD_WITH_CARRY, REGISTER_B>), 1, 4, 0, "ADC A,B") \
+	OPCODE(0x89, (arithmetic<ArithmeticOperation::ADD_WITH_CARRY, REGISTER_C>), 1, 4, 0, "ADC A,C") \
+	OPCODE(0x8A, (arithmetic<ArithmeticOperation::ADD_WITH_CARRY, REGISTER_D>), 1, 4, 0, "ADC A,D") \
+	OPCODE(0x8B, (arithmetic<ArithmeticOperation::ADD_WITH_CARRY, REGISTER_E>), 1, 4, 0, "ADC A,E") \
+	OPCODE(0x8C, (arithmetic<ArithmeticOperation::ADD_WITH_CARRY, REGISTER_H>), 1, 4, 0, "ADC A,H") \
+	OPCODE(0x8D, (arithmetic<ArithmeticOperation::ADD_WITH_CARRY, REGISTER_L>), 1, 4, 0, "ADC A,L") \
+	OPCODE(0x8E, (arithmetic<ArithmeticOperation::ADD_WITH_CARRY, REGISTER_HL_ADDRESS>), 1, 8, 0, "ADC A,(HL)") \
+	OPCODE(0x8F, (arithmetic<ArithmeticOperation::ADD_WITH_CARRY, REGISTER_A>), 1, 4, 0, "ADC A,A") \
+	OPCODE(0x90, (arithmetic<ArithmeticOperation::SUBTRACT, REGISTER_B>), 1, 4, 0, "SUB A,B") \
+	OPCODE(0x91, (arithmetic<ArithmeticOperation::SUBTRACT, REGISTER_C>), 1, 4, 0, "SUB A,C") \
+	OPCODE(0x92, (arithmetic<ArithmeticOperation::SUBTRACT, REGISTER_D>), 1, 4, 0, "SUB A,D") \
+	OPCODE(0x93, (arithmetic<ArithmeticOperation::SUBTRACT, REGISTER_E>), 1, 4, 0, "SUB A,E") \
+	OPCODE(0x94, (arithmetic<ArithmeticOperation::SUBTRACT, REGISTER_H>), 1, 4, 0, "SUB A,H") \
+	OPCODE(0x95, (arithmetic<ArithmeticOperation::SUBTRACT, REGISTER_L>), 1, 4, 0, "SUB A,L") \
+	OPCODE(0x96, (arithmetic<ArithmeticOperation::SUBTRACT, REGISTER_HL_ADDRESS>), 1, 8, 0, "SUB A,(HL)") \
+	OPCODE(0x97, (arithmetic<ArithmeticOperation::SUBTRACT, REGISTER_A>), 1, 4, 0, "SUB A,A") \
+	OPCODE(0x98, (arithmetic<ArithmeticOperation::SUBTRACT_WITH_CARRY, REGISTER_B>), 1, 4, 0, "SBC A,B") \
+	OPCODE(0x99, (arithmetic<ArithmeticOperation::SUBTRACT_WITH_CARRY, REGISTER_C>), 1, 4, 0, "SBC A,c") \
+	OPCODE(0x9A, (arithmetic<ArithmeticOperation::SUBTRACT_WITH_CARRY, REGISTER_D>), 1, 4, 0, "SBC A,D") \
+	OPCODE(0x9B, (arithmetic<ArithmeticOperation::SUBTRACT_WITH_CARRY, REGISTER_E>), 1, 4, 0, "SBC A,E") \
+	OPCODE(0x9C, (arithmetic<ArithmeticOperation::SUBTRACT_WITH_CARRY, REGISTER_H>), 1, 4, 0, "SBC A,H") \
+	OPCODE(0x9D, (arithmetic<ArithmeticOperation::SUBTRACT_WITH_CARRY, REGISTER_L>), 1, 4, 0, "SBC A,L") \
+	OPCODE(0x9E, (arithmetic<ArithmeticOperation::SUBTRACT_WITH_CARRY, REGISTER_HL_ADDRESS>), 1, 8, 0, "SBC A,(HL)") \
+	OPCODE(0x9F, (arithmetic<ArithmeticOperation::SUBTRACT_WITH_CARRY, REGISTER_A>), 1, 4, 0, "SBC A,A") \
+	OPCODE(0xA0, (arithmetic<ArithmeticOperation::AND, REGISTER_B>), 1, 4, 0, "AND A,B") \
+	OPCODE(0xA1, (arithmetic<ArithmeticOperation::AND, REGISTER_C>), 1, 4, 0, "AND A,C") \
+	OPCODE(0xA2, (arithmetic<ArithmeticOperation::AND, REGISTER_D>), 1, 4, 0, "AND A,D") \
+	OPCODE(0xA3, (arithmetic<ArithmeticOperation::AND, REGISTER_E>), 1, 4, 0, "AND A,E") \
+	OPCODE(0xA4, (arithmetic<ArithmeticOperation::AND, REGISTER_H>), 1, 4, 0, "AND A,H") \
+	OPCODE(0xA5, (arithmetic<ArithmeticOperation::AND, REGISTER_L>), 1, 4, 0, "AND A,L") \
+	OPCODE(0xA6, (arithmetic<ArithmeticOperation::AND, REGISTER_HL_ADDRESS>), 1, 8, 0, "AND A,(HL)") \
+	OPCODE(0xA7, (arithmetic<ArithmeticOperation::AND, REGISTER_A>), 1, 4, 0, "AND A,A") \
+	OPCODE(0xA8, (arithmetic<ArithmeticOperation::XOR, REGISTER_B>), 1, 4, 0, "XOR A,B") \
+	OPCODE(0xA9, (arithmetic<ArithmeticOperation::XOR, REGISTER_C>), 1, 4, 0, "XOR A,C") \
+	OPCODE(0xAA, (arithmetic<ArithmeticOperation::XOR, REGISTER_D>), 1, 4, 0, "XOR A,D") \
+	OPCODE(0xAB, (arithmetic<ArithmeticOperation::XOR, REGISTER_E>), 1, 4, 0, "XOR A,E") \
+	OPCODE(0xAC, (arithmetic<ArithmeticOperation::XOR, REGISTER_H>), 1, 4, 0, "XOR A,H") \
+	OPCODE(0xAD, (arithmetic<ArithmeticOperation::XOR, REGISTER_L>), 1, 4, 0, "XOR A,L") \
+	OPCODE(0xAE, (arithmetic<ArithmeticOperation::XOR, REGISTER_HL_ADDRESS>), 1, 8, 0, "XOR A,(HL)") \
+	OPCODE(0xAF, (arithmetic<ArithmeticOperation::XOR, REGISTER_A>), 1, 4, 0, "XOR A,A") \
+	OPCODE(0xB0, (arithmetic<ArithmeticOperation::OR, REGISTER_B>), 1, 4, 0, "OR A,B") \
+	OPCODE(0xB1, (arithmetic<ArithmeticOperation::OR, REGISTER_C>), 1, 4, 0, "OR A,C") \
+	OPCODE(0xB2, (arithmetic<ArithmeticOperation::OR, REGISTER_D>), 1, 4, 0, "OR A,D") \
+	OPCODE(0xB3, (arithmetic<ArithmeticOperation::OR, REGISTER_E>), 1, 4, 0, "OR A,E") \
+	OPCODE(0xB4, (arithmetic<ArithmeticOperation::OR, REGISTER_H>), 1, 4, 0, "OR A,H") \
+	OPCODE(0xB5, (arithmetic<ArithmeticOperation::OR, REGISTER_L>), 1, 4, 0, "OR A,L") \
+	OPCODE(0xB6, (arithmetic<ArithmeticOperation::OR, REGISTER_HL_ADDRESS>), 1, 8, 0, "OR A,(HL)") \
+	OPCODE(0xB7, (arithmetic<ArithmeticOperation::OR, REGISTER_A>), 1, 4, 0, "OR A,A") \
+	OPCODE(0xB8, (arithmetic<ArithmeticOperation::COMPARE, REGISTER_B>), 1, 4, 0, "CP A,B") \
+	OPCODE(0xB9, (arithmetic<ArithmeticOperation::COMPARE, REGISTER_C>), 1, 4, 0, "CP A,C") \
+	OPCODE(0xBA, (arithmetic<ArithmeticOperation::COMPARE, REGISTER_D>), 1, 4, 0, "CP A,D") \
+	OPCODE(0xBB, (arithmetic<ArithmeticOperation::COMPARE, REGISTER_E>), 1, 4, 0, "CP A,E") \
+	OPCODE(0xBC, (arithmetic<ArithmeticOperation::COMPARE, REGISTER_H>), 1, 4, 0, "CP A,H") \
+	OPCODE(0xBD, (arithmetic<ArithmeticOperation::COMPARE, REGISTER_L>), 1, 4, 0, "CP A,L") \
+	OPCODE(0xBE, (arithmetic<ArithmeticOperation::COMPARE, REGISTER_HL_ADDRESS>), 1, 8, 0, "CP A,(HL)") \
+	OPCODE(0xBF, (arithmetic<ArithmeticOperation::COMPARE, REGISTER_A>), 1, 4, 0, "CP A,A") \
+	OPCODE(0xC0, returnNotZero, 1, 8, 20, "RET NZ") \
+	OPCODE(0xC1, popBC, 1, 12, 0, "POP BC") \
+	OPCODE(0xC2, jumpNotZeroToNumber, 3, 12, 16, "JP NZ,u16") \
+	OPCODE(0xC3, jumpToNumber, 3, 16, 0, "JP u16") \
+	OPCODE(0xC4, callNotZeroNumber, 3, 12, 24, "CALL NZ,u16") \
+	OPCODE(0xC5, pushBC, 1, 16, 0, "PUSH BC") \
+	OPCODE(0xC6, addNumberToA, 2, 8, 0, "ADD A,u8") \
+	OPCODE(0xC7, restart00, 1, 16, 0, "RST 00h") \
+	OPCODE(0xC8, returnZero, 1, 8, 20, "RET Z") \
+	OPCODE(0xC9, returnInstr, 1, 16, 0, "RET") \
+	OPCODE(0xCA, jumpZeroToNumber, 3, 12, 16, "JP Z,u16") \
+	OPCODE(0xCB, prefixOPCode, 2, 0, 0, "PREFIX CB") \
+	OPCODE(0xCC, callZeroNumber, 3, 12, 24, "CALL Z,u16") \
+	OPCODE(0xCD, callInstr, 3, 24, 0, "CALL u16") \
+	OPCODE(0xCE, addNumberAndCarryToA, 2, 8, 0, "ADC A,u8") \
+	OPCODE(0xCF, restart08, 1, 16, 0, "RST 08h") \
+	OPCODE(0xD0, returnNotCarry, 1, 8, 20, "RET NC") \
+	OPCODE(0xD1, popDE, 1, 12, 0, "POP DE") \
+	OPCODE(0xD2, jumpNotCarryToNumber, 3, 12, 16, "JP NC,u16") \
+	OPCODE(0xD3, invalidInstruction, 1, 0, 0, "D3=INVALID") \
+	OPCODE(0xD4, callNotCarryNumber, 3, 12, 24, "CALL NC,u16") \
+	OPCODE(0xD5, pushDE, 1, 16, 0, "PUSH DE") \
+	OPCODE(0xD6, subNumberFromA, 2, 8, 0, "SUB A,u8") \
+	OPCODE(0xD7, restart10, 1, 16, 0, "RST 10h") \
+	OPCODE(0xD8, returnCarry, 1, 8, 20, "RET C") \
+	OPCODE(0xD9, returnFromInterruptHandler, 1, 16, 0, "RETI") \
+	OPCODE(0xDA, jumpCarryToNumber, 3, 12, 16, "JP C,u16") \
+	OPCODE(0xDB, invalidInstruction, 1, 0, 0, "DB=INVALID") \
+	OPCODE(0xDC, callCarryNumber, 3, 12, 24, "CALL C,u16") \
+	OPCODE(0xDD, invalidInstruction, 1, 0, 0, "DD=INVALID") \
+	OPCODE(0xDE, subtractNumberAndCarryFromA, 2, 8, 0, "SBC A,u8") \
+	OPCODE(0xDF, restart18, 1, 16, 0, "RST 18h") \
+	OPCODE(0xE0, loadAIntoSpecialAddressPlusNumber, 2, 12, 0, "LD (FF00+u8),A") \
+	OPCODE(0xE1, POPHL, 1, 12, 0, "POP HL") \
+	OPCODE(0xE2, loadAIntoSpecialAddressPlusC, 1, 8, 0, "LD (FF00+C),A") \
+	OPCODE(0xE3, invalidInstruction, 1, 0, 0, "E3=INVALID") \
+	OPCODE(0xE4, invalidInstruction, 1, 0, 0, "E4=INVALID") \
+	OPCODE(0xE5, pushHL, 1, 16, 0, "PUSH HL") \
+	OPCODE(0xE6, bitwiseAndAAndNumber, 2, 8, 0, "AND A,u8") \
+	OPCODE(0xE7, restart20, 1, 16, 0, "RST 20h") \
+	OPCODE(0xE8, addNumberToStackPointer, 2, 16, 0, "ADD SP,i8") \
+	OPCODE(0xE9, jumpToHL, 1, 4, 0, "JP HL") \
+	OPCODE(0xEA, loadAIntoNumberAddress, 3, 16, 0, "LD (u16),A") \
+	OPCODE(0xEB, invalidInstruction, 1, 0, 0, "EB=INVALID") \
+	OPCODE(0xEC, invalidInstruction, 1, 0, 0, "EC=INVALID") \
+	OPCODE(0xED, invalidInstruction, 1, 0, 0, "ED=INVALID") \
+	OPCODE(0xEE, xorAAndNumber, 2, 8, 0, "XOR A,u8") \
+	OPCODE(0xEF, restart28, 1, 16, 0, "RST 28h") \
+	OPCODE(0xF0, loadSpecialAddressPlusNumberIntoA, 2, 12, 0, "LD A,(FF00+u8)") \
+	OPCODE(0xF1, POPAF, 1, 12, 0, "POP AF") \
+	OPCODE(0xF2, loadSpecialAddressPlusCIntoA, 1, 8, 0, "LD A,(FF00+C)") \
+	OPCODE(0xF3, disableInterrupts, 1, 4, 0, "DI") \
+	OPCODE(0xF4, invalidInstruction, 1, 0, 0, "F4=INVALID") \
+	OPCODE(0xF5, pushAF, 1, 16, 0, "PUSH AF") \
+	OPCODE(0xF6, bitwiseOrAAndNumber, 2, 8, 0, "OR A,u8") \
+	OPCODE(0xF7, restart30, 1, 16, 0, "RST 30h") \
+	OPCODE(0xF8, loadStackPointerPlusNumberIntoHL, 2, 12, 0, "LD HL,SP+i8") \
+	OPCODE(0xF9, loadHLIntoStackPointer, 1, 8, 0, "LD SP,HL") \
+	OPCODE(0xFA, loadAddressIntoA, 3, 16, 0, "LD A,(u16)") \
+	OPCODE(0xFB, enableInterrupts, 1, 4, 0, "EI") \
+	OPCODE(0xFC, invalidInstruction, 1, 0, 0, "FC=INVALID") \
+	OPCODE(0xFD, invalidInstruction, 1, 0, 0, "FD=INVALID") \
+	OPCODE(0xFE, compareAWithNumber, 2, 8, 0, "CP A,u8") \
+	OPCODE(0xFF, restart38, 1, 16, 0, "RST 38h")
+
+#define GGB_EXTENDED_OPCODE_TABLE(OPCODE) \
+	OPCODE(0x00, rotateBLeft, 1, 8, 0, "RLC B") \
+	OPCODE(0x01, rotateCLeft, 1, 8, 0, "RLC C") \
+	OPCODE(0x02, rotateDLeft, 1, 8, 0, "RLC D") \
+	OPCODE(0x03, rotateELeft, 1, 8, 0, "RLC E") \
+	OPCODE(0x04, rotateHLeft, 1, 8, 0, "RLC H") \
+	OPCODE(0x05, rotateLLeft, 1, 8, 0, "RLC L") \
+	OPCODE(0x06, rotateHLAddressLeft, 1, 16, 0, "RLC (HL)") \
+	OPCODE(0x07, rotateALeftSetZero, 1, 8, 0, "RLC A") \
+	OPCODE(0x08, rotateBRight, 1, 8, 0, "RRC B") \
+	OPCODE(0x09, rotateCRight, 1, 8, 0, "RRC C") \
+	OPCODE(0x0A, rotateDRight, 1, 8, 0, "RRC D") \
+	OPCODE(0x0B, rotateERight, 1, 8, 0, "RRC E") \
+	OPCODE(0x0C, rotateHRight, 1, 8, 0, "RRC H") \
+	OPCODE(0x0D, rotateLRight, 1, 8, 0, "RRC L") \
+	OPCODE(0x0E, rotateHLAddressRight, 1, 16, 0, "RRC (HL)") \
+	OPCODE(0x0F, rotateARightSetZero, 1, 8, 0, "RRC A") \
+	OPCODE(0x10, rotateBLeftThroughCarry, 1, 8, 0, "RL B") \
+	OPCODE(0x11, rotateCLeftThroughCarry, 1, 8, 0, "RL C") \
+	OPCODE(0x12, rotateDLeftThroughCarry, 1, 8, 0, "RL D") \
+	OPCODE(0x13, rotateELeftThroughCarry, 1, 8, 0, "RL E") \
+	OPCODE(0x14, rotateHLeftThroughCarry, 1, 8, 0, "RL H") \
+	OPCODE(0x15, rotateLLeftThroughCarry, 1, 8, 0, "RL L") \
+	OPCODE(0x16, rotateHLAddressLeftThroughCarry, 1, 16, 0, "RL (HL)") \
+	OPCODE(0x17, rotateALeftThroughCarrySetZero, 1, 8, 0, "RL A") \
+	OPCODE(0x18, rotateBRightThroughCarry, 1, 8, 0, "RR B") \
+	OPCODE(0x19, rotateCRightThroughCarry, 1, 8, 0, "RR C") \
+	OPCODE(0x1A, rotateDRightThroughCarry, 1, 8, 0, "RR D") \
+	OPCODE(0x1B, rotateERightThroughCarry, 1, 8, 0, "RR E") \
+	OPCODE(0x1C, rotateHRightThroughCarry, 1, 8, 0, "RR H") \
+	OPCODE(0x1D, rotateLRightThroughCarry, 1, 8, 0, "RR L") \
+	OPCODE(0x1E, rotateHLAddressRightThroughCarry, 1, 16, 0, "RR (HL)") \
+	OPCODE(0x1F, rotateARightThroughCarrySetZero, 1, 8, 0, "RR A") \
+	OPCODE(0x20, shiftBLeftArithmetically, 1, 8, 0, "SLA B") \
+	OPCODE(0x21, shiftCLeftArithmetically, 1, 8, 0, "SLA C") \
+	OPCODE(0x22, shiftDLeftArithmetically, 1, 8, 0, "SLA D") \
+	OPCODE(0x23, shiftELeftArithmetically, 1, 8, 0, "SLA E") \
+	OPCODE(0x24, shiftHLeftArithmetically, 1, 8, 0, "SLA H") \
+	OPCODE(0x25, shiftLLeftArithmetically, 1, 8, 0, "SLA L") \
+	OPCODE(0x26, shiftHLAddressLeftArithmetically, 1, 16, 0, "SLA (HL)") \
+	OPCODE(0x27, shiftALeftArithmetically, 1, 8, 0, "SLA A") \
+	OPCODE(0x28, shiftBRightArithmetically, 1, 8, 0, "SRA B") \
+	OPCODE(0x29, shiftCRightArithmetically, 1, 8, 0, "SRA C") \
+	OPCODE(0x2A, shiftDRightArithmetically, 1, 8, 0, "SRA D") \
+	OPCODE(0x2B, shiftERightArithmetically, 1, 8, 0, "SRA E") \
+	OPCODE(0x2C, shiftHRightArithmetically, 1, 8, 0, "SRA H") \
+	OPCODE(0x2D, shiftLRightArithmetically, 1, 8, 0, "SRA L") \
+	OPCODE(0x2E, shiftHLAddressRightArithmetically, 1, 16, 0, "SRA (HL)") \
+	OPCODE(0x2F, shiftARightArithmetically, 1, 8, 0, "SRA A") \
+	OPCODE(0x30, swapB, 1, 8, 0, "SWAP B") \
+	OPCODE(0x31, swapC, 1, 8, 0, "SWAP C") \
+	OPCODE(0x32, swapD, 1, 8, 0, "SWAP D") \
+	OPCODE(0x33, swapE, 1, 8, 0, "SWAP E") \
+	OPCODE(0x34, swapH, 1, 8, 0, "SWAP H") \
+	OPCODE(0x35, swapL, 1, 8, 0, "SWAP L") \
+	OPCODE(0x36, swapHLAddress, 1, 16, 0, "SWAP (HL)") \
+	OPCODE(0x37, swapA, 1, 8, 0, "SWAP A") \
+	OPCODE(0x38, shiftBRightLogically, 1, 8, 0, "SRL B") \
+	OPCODE(0x39, shiftCRightLogically, 1, 8, 0, "SRL C") \
+	OPCODE(0x3A, shiftDRightLogically, 1, 8, 0, "SRL D") \
+	OPCODE(0x3B, shiftERightLogically, 1, 8, 0, "SRL E") \
+	OPCODE(0x3C, shiftHRightLogically, 1, 8, 0, "SRL H") \
+	OPCODE(0x3D, shiftLRightLogically, 1, 8, 0, "SRL L") \
+	OPCODE(0x3E, shiftHLAddressRightLogically, 1, 16, 0, "SRL (HL)") \
+	OPCODE(0x3F, shiftARightLogically, 1, 8, 0, "SRL A") \
+	OPCODE(0x40, (bitTest<0, REGISTER_B>), 1, 8, 0, "BIT 0,B") \
+	OPCODE(0x41, (bitTest<0, REGISTER_C>), 1, 8, 0, "BIT 0,C") \
+	OPCODE(0x42, (bitTest<0, REGISTER_D>), 1, 8, 0, "BIT 0,D") \
+	OPCODE(0x43, (bitTest<0, REGISTER_E>), 1, 8, 0, "BIT 0,E") \
+	OPCODE(0x44, (bitTest<0, REGISTER_H>), 1, 8, 0, "BIT 0,H") \
+	OPCODE(0x45, (bitTest<0, REGISTER_L>), 1, 8, 0, "BIT 0,L") \
+	OPCODE(0x46, (bitTest<0, REGISTER_HL_ADDRESS>), 1, 12, 0, "BIT 0,(HL)") \
+	OPCODE(0x47, (bitTest<0, REGISTER_A>), 1, 8, 0, "BIT 0,A") \
+	OPCODE(0x48, (bitTest<1, REGISTER_B>), 1, 8, 0, "BIT 1,B") \
+	OPCODE(0x49, (bitTest<1, REGISTER_C>), 1, 8, 0, "BIT 1,C") \
+	OPCODE(0x4A, (bitTest<1, REGISTER_D>), 1, 8, 0, "BIT 1,D") \
+	OPCODE(0x4B, (bitTest<1, REGISTER_E>), 1, 8, 0, "BIT 1,E") \
+	OPCODE(0x4C, (bitTest<1, REGISTER_H>), 1, 8, 0, "BIT 1,H") \
+	OPCODE(0x4D, (bitTest<1, REGISTER_L>), 1, 8, 0, "BIT 1,L") \
+	OPCODE(0x4E, (bitTest<1, REGISTER_HL_ADDRESS>), 1, 12, 0, "BIT 1,(HL)") \
+	OPCODE(0x4F, (bitTest<1, REGISTER_A>), 1, 8, 0, "BIT 1,A") \
+	OPCODE(0x50, (bitTest<2, REGISTER_B>), 1, 8, 0, "BIT 2,B") \
+	OPCODE(0x51, (bitTest<2, REGISTER_C>), 1, 8, 0, "BIT 2,C") \
+	OPCODE(0x52, (bitTest<2, REGISTER_D>), 1, 8, 0, "BIT 2,D") \
+	OPCODE(0x53, (bitTest<2, REGISTER_E>), 1, 8, 0, "BIT 2,E") \
+	OPCODE(0x54, (bitTest<2, REGISTER_H>), 1, 8, 0, "BIT 2,H") \
+	OPCODE(0x55, (bitTest<2, REGISTER_L>), 1, 8, 0, "BIT 2,L") \
+	OPCODE(0x56, (bitTest<2, REGISTER_HL_ADDRESS>), 1, 12, 0, "BIT 2,(HL)") \
+	OPCODE(0x57, (bitTest<2, REGISTER_A>), 1, 8, 0, "BIT 2,A") \
+	OPCODE(0x58, (bitTest<3, REGISTER_B>), 1, 8, 0, "BIT 3,B") \
+	OPCODE(0x59, (bitTest<3, REGISTER_C>), 1, 8, 0, "BIT 3,C") \
+	OPCODE(0x5A, (bitTest<3, REGISTER_D>), 1, 8, 0, "BIT 3,D") \
+	OPCODE(0x5B, (bitTest<3, REGISTER_E>), 1, 8, 0, "BIT 3,E") \
+	OPCODE(0x5C, (bitTest<3, REGISTER_H>), 1, 8, 0, "BIT 3,H") \
+	OPCODE(0x5D, (bitTest<3, REGISTER_L>), 1, 8, 0, "BIT 3,L") \
+	OPCODE(0x5E, (bitTest<3, REGISTER_HL_ADDRESS>), 1, 12, 0, "BIT 3,(HL)") \
+	OPCODE(0x5F, (bitTest<3, REGISTER_A>), 1, 8, 0, "BIT 3,A") \
+	OPCODE(0x60, (bitTest<4, REGISTER_B>), 1, 8, 0, "BIT 4,B") \
+	OPCODE(0x61, (bitTest<4, REGISTER_C>), 1, 8, 0, "BIT 4,C") \
+	OPCODE(0x62, (bitTest<4, REGISTER_D>), 1, 8, 0, "BIT 4,D") \
+	OPCODE(0x63, (bitTest<4, REGISTER_E>), 1, 8, 0, "BIT 4,E") \
+	OPCODE(0x64, (bitTest<4, REGISTER_H>), 1, 8, 0, "BIT 4,H") \
+	OPCODE(0x65, (bitTest<4, REGISTER_L>), 1, 8, 0, "BIT 4,L") \
+	OPCODE(0x66, (bitTest<4, REGISTER_HL_ADDRESS>), 1, 12, 0, "BIT 4,(HL)") \
+	OPCODE(0x67, (bitTest<4, REGISTER_A>), 1, 8, 0, "BIT 4,A") \
+	OPCODE(0x68, (bitTest<5, REGISTER_B>), 1, 8, 0, "BIT 5,B") \
+	OPCODE(0x69, (bitTest<5, REGISTER_C>), 1, 8, 0, "BIT 5,C") \
+	OPCODE(0x6A, (bitTest<5, REGISTER_D>), 1, 8, 0, "BIT 5,D") \
+	OPCODE(0x6B, (bitTest<5, REGISTER_E>), 1, 8, 0, "BIT 5,E") \
+	OPCODE(0x6C, (bitTest<5, REGISTER_H>), 1, 8, 0, "BIT 5,H") \
+	OPCODE(0x6D, (bitTest<5, REGISTER_L>), 1, 8, 0, "BIT 5,L") \
+	OPCODE(0x6E, (bitTest<5, REGISTER_HL_ADDRESS>), 1, 12, 0, "BIT 5,(HL)") \
+	OPCODE(0x6F, (bitTest<5, REGISTER_A>), 1, 8, 0, "BIT 5,A") \
+	OPCODE(0x70, (bitTest<6, REGISTER_B>), 1, 8, 0, "BIT 6,B") \
+	OPCODE(0x71, (bitTest<6, REGISTER_C>), 1, 8, 0, "BIT 6,C") \
+	OPCODE(0x72, (bitTest<6, REGISTER_D>), 1, 8, 0, "BIT 6,D") \
+	OPCODE(0x73, (bitTest<6, REGISTER_E>), 1, 8, 0, "BIT 6,E") \
+	OPCODE(0x74, (bitTest<6, REGISTER_H>), 1, 8, 0, "BIT 6,H") \
+	OPCODE(0x75, (bitTest<6, REGISTER_L>), 1, 8, 0, "BIT 6,L") \
+	OPCODE(0x76, (bitTest<6, REGISTER_HL_ADDRESS>), 1, 12, 0, "BIT 6,(HL)") \
+	OPCODE(0x77, (bitTest<6, REGISTER_A>), 1, 8, 0, "BIT 6,A") \
+	OPCODE(0x78, (bitTest<7, REGISTER_B>), 1, 8, 0, "BIT 7,B") \
+	OPCODE(0x79, (bitTest<7, REGISTER_C>), 1, 8, 0, "BIT 7,C") \
+	OPCODE(0x7A, (bitTest<7, REGISTER_D>), 1, 8, 0, "BIT 7,D") \
+	OPCODE(0x7B, (bitTest<7, REGISTER_E>), 1, 8, 0, "BIT 7,E") \
+	OPCODE(0x7C, (bitTest<7, REGISTER_H>), 1, 8, 0, "BIT 7,H") \
+	OPCODE(0x7D, (bitTest<7, REGISTER_L>), 1, 8, 0, "BIT 7,L") \
+	OPCODE(0x7E, (bitTest<7, REGISTER_HL_ADDRESS>), 1, 12, 0, "BIT 7,(HL)") \
+	OPCODE(0x7F, (bitTest<7, REGISTER_A>), 1, 8, 0, "BIT 7,A") \
+	OPCODE(0x80, (bitReset<0, REGISTER_B>), 1, 8, 0, "RES 0,B") \
+	OPCODE(0x81, (bitReset<0, REGISTER_C>), 1, 8, 0, "RES 0,C") \
+	OPCODE(0x82, (bitReset<0, REGISTER_D>), 1, 8, 0, "RES 0,D") \
+	OPCODE(0x83, (bitReset<0, REGISTER_E>), 1, 8, 0, "RES 0,E") \
+	OPCODE(0x84, (bitReset<0, REGISTER_H>), 1, 8, 0, "RES 0,H") \
+	OPCODE(0x85, (bitReset<0, REGISTER_L>), 1, 8, 0, "RES 0,L") \
+	OPCODE(0x86, (bitReset<0, REGISTER_HL_ADDRESS>), 1, 16, 0, "RES 0,(HL)") \
+	OPCODE(0x87, (bitReset<0, REGISTER_A>), 1, 8, 0, "RES 0,A") \
+	OPCODE(0x88, (bitReset<1, REGISTER_B>), 1, 8, 0, "RES 1,B") \
+	OPCODE(0x89, (bitReset<1, REGISTER_C>), 1, 8, 0, "RES 1,C") \
+	OPCODE(0x8A, (bitReset<1, REGISTER_D>), 1, 8, 0, "RES 1,D") \
+	OPCODE(0x8B, (bitReset<1, REGISTER_E>), 1, 8, 0, "RES 1,E") \
+	OPCODE(0x8C, (bitReset<1, REGISTER_H>), 1, 8, 0, "RES 1,H") \
+	OPCODE(0x8D, (bitReset<1, REGISTER_L>), 1, 8, 0, "RES 1,L") \
+	OPCODE(0x8E, (bitReset<1, REGISTER_HL_ADDRESS>), 1, 16, 0, "RES 1,(HL)") \
+	OPCODE(0x8F, (bitReset<1, REGISTER_A>), 1, 8, 0, "RES 1,A") \
+	OPCODE(0x90, (bitReset<2, REGISTER_B>), 1, 8, 0, "RES 2,B") \
+	OPCODE(0x91, (bitReset<2, REGISTER_C>), 1, 8, 0, "RES 2,C") \
+	OPCODE(0x92, (bitReset<2, REGISTER_D>), 1, 8, 0, "RES 2,D") \
+	OPCODE(0x93, (bitReset<2, REGISTER_E>), 1, 8, 0, "RES 2,E") \
+	OPCODE(0x94, (bitReset<2, REGISTER_H>), 1, 8, 0, "RES 2,H") \
+	OPCODE(0x95, (bitReset<2, REGISTER_L>), 1, 8, 0, "RES 2,L") \
+	OPCODE(0x96, (bitReset<2, REGISTER_HL_ADDRESS>), 1, 16, 0, "RES 2,(HL)") \
+	OPCODE(0x97, (bitReset<2, REGISTER_A>), 1, 8, 0, "RES 2,A") \
+	OPCODE(0x98, (bitReset<3, REGISTER_B>), 1, 8, 0, "RES 3,B") \
+	OPCODE(0x99, (bitReset<3, REGISTER_C>), 1, 8, 0, "RES 3,C") \
+	OPCODE(0x9A, (bitReset<3, REGISTER_D>), 1, 8, 0, "RES 3,D") \
+	OPCODE(0x9B, (bitReset<3, REGISTER_E>), 1, 8, 0, "RES 3,E") \
+	OPCODE(0x9C, (bitReset<3, REGISTER_H>), 1, 8, 0, "RES 3,H") \
+	OPCODE(0x9D, (bitReset<3, REGISTER_L>), 1, 8, 0, "RES 3,L") \
+	OPCODE(0x9E, (bitReset<3, REGISTER_HL_ADDRESS>), 1, 16, 0, "RES 3,(HL)") \
+	OPCODE(0x9F, (bitReset<3, REGISTER_A>), 1, 8, 0, "RES 3,A") \
+	OPCODE(0xA0, (bitReset<4, REGISTER_B>), 1, 8, 0, "RES 4,B") \
+	OPCODE(0xA1, (bitReset<4, REGISTER_C>), 1, 8, 0, "RES 4,C") \
+	OPCODE(0xA2, (bitReset<4, REGISTER_D>), 1, 8, 0, "RES 4,D") \
+	OPCODE(0xA3, (bitReset<4, REGISTER_E>), 1, 8, 0, "RES 4,E") \
+	OPCODE(0xA4, (bitReset<4, REGISTER_H>), 1, 8, 0, "RES 4,H") \
+	OPCODE(0xA5, (bitReset<4, REGISTER_L>), 1, 8, 0, "RES 4,L") \
+	OPCODE(0xA6, (bitReset<4, REGISTER_HL_ADDRESS>), 1, 16, 0, "RES 4,(HL)") \
+	OPCODE(0xA7, (bitReset<4, REGISTER_A>), 1, 8, 0, "RES 4,A") \
+	OPCODE(0xA8, (bitReset<5, REGISTER_B>), 1, 8, 0, "RES 5,B") \
+	OPCODE(0xA9, (bitReset<5, REGISTER_C>), 1, 8, 0, "RES 5,C") \
+	OPCODE(0xAA, (bitReset<5, REGISTER_D>), 1, 8, 0, "RES 5,D") \
+	OPCODE(0xAB, (bitReset<5, REGISTER_E>), 1, 8, 0, "RES 5,E") \
+	OPCODE(0xAC, (bitReset<5, REGISTER_H>), 1, 8, 0, "RES 5,H") \
+	OPCODE(0xAD, (bitReset<5, REGISTER_L>), 1, 8, 0, "RES 5,L") \
+	OPCODE(0xAE, (bitReset<5, REGISTER_HL_ADDRESS>), 1, 16, 0, "RES 5,(HL)") \
+	OPCODE(0xAF, (bitReset<5, REGISTER_A>), 1, 8, 0, "RES 5,A") \
+	OPCODE(0xB0, (bitReset<6, REGISTER_B>), 1, 8, 0, "RES 6,B") \
+	OPCODE(0xB1, (bitReset<6, REGISTER_C>), 1, 8, 0, "RES 6,C") \
+	OPCODE(0xB2, (bitReset<6, REGISTER_D>), 1, 8, 0, "RES 6,D") \
+	OPCODE(0xB3, (bitReset<6, REGISTER_E>), 1, 8, 0, "RES 6,E") \
+	OPCODE(0xB4, (bitReset<6, REGISTER_H>), 1, 8, 0, "RES 6,H") \
+	OPCODE(0xB5, (bitReset<6, REGISTER_L>), 1, 8, 0, "RES 6,L") \
+	OPCODE(0xB6, (bitReset<6, REGISTER_HL_ADDRESS>), 1, 16, 0, "RES 6,(HL)") \
+	OPCODE(0xB7, (bitReset<6, REGISTER_A>), 1, 8, 0, "RES 6,A") \
+	OPCODE(0xB8, (bitReset<7, REGISTER_B>), 1, 8, 0, "RES 7,B") \
+	OPCODE(0xB9, (bitReset<7, REGISTER_C>), 1, 8, 0, "RES 7,C") \
+	OPCODE(0xBA, (bitReset<7, REGISTER_D>), 1, 8, 0, "RES 7,D") \
+	OPCODE(0xBB, (bitReset<7, REGISTER_E>), 1, 8, 0, "RES 7,E") \
+	OPCODE(0xBC, (bitReset<7, REGISTER_H>), 1, 8, 0, "RES 7,H") \
+	OPCODE(0xBD, (bitReset<7, REGISTER_L>), 1, 8, 0, "RES 7,L") \
+	OPCODE(0xBE, (bitReset<7, REGISTER_HL_ADDRESS>), 1, 16, 0, "RES 7,(HL)") \
+	OPCODE(0xBF, (bitReset<7, REGISTER_A>), 1, 8, 0, "RES 7,A") \
+	OPCODE(0xC0, (bitSet<0, REGISTER_B>), 1, 8, 0, "SET 0,B") \
+	OPCODE(0xC1, (bitSet<0, REGISTER_C>), 1, 8, 0, "SET 0,C") \
+	OPCODE(0xC2, (bitSet<0, REGISTER_D>), 1, 8, 0, "SET 0,D") \
+	OPCODE(0xC3, (bitSet<0, REGISTER_E>), 1, 8, 0, "SET 0,E") \
+	OPCODE(0xC4, (bitSet<0, REGISTER_H>), 1, 8, 0, "SET 0,H") \
+	OPCODE(0xC5, (bitSet<0, REGISTER_L>), 1, 8, 0, "SET 0,L") \
+	OPCODE(0xC6, (bitSet<0, REGISTER_HL_ADDRESS>), 1, 16, 0, "SET 0,(HL)") \
+	OPCODE(0xC7, (bitSet<0, REGISTER_A>), 1, 8, 0, "SET 0,A") \
+	OPCODE(0xC8, (bitSet<1, REGISTER_B>), 1, 8, 0, "SET 1,B") \
+	OPCODE(0xC9, (bitSet<1, REGISTER_C>), 1, 8, 0, "SET 1,C") \
+	OPCODE(0xCA, (bitSet<1, REGISTER_D>), 1, 8, 0, "SET 1,D") \
+	OPCODE(0xCB, (bitSet<1, REGISTER_E>), 1, 8, 0, "SET 1,E") \
+	OPCODE(0xCC, (bitSet<1, REGISTER_H>), 1, 8, 0, "SET 1,H") \
+	OPCODE(0xCD, (bitSet<1, REGISTER_L>), 1, 8, 0, "SET 1,L") \
+	OPCODE(0xCE, (bitSet<1, REGISTER_HL_ADDRESS>), 1, 16, 0, "SET 1,(HL)") \
+	OPCODE(0xCF, (bitSet<1, REGISTER_A>), 1, 8, 0, "SET 1,A") \
+	OPCODE(0xD0, (bitSet<2, REGISTER_B>), 1, 8, 0, "SET 2,B") \
+	OPCODE(0xD1, (bitSet<2, REGISTER_C>), 1, 8, 0, "SET 2,C") \
+	OPCODE(0xD2, (bitSet<2, REGISTER_D>), 1, 8, 0, "SET 2,D") \
+	OPCODE(0xD3, (bitSet<2, REGISTER_E>), 1, 8, 0, "SET 2,E") \
+	OPCODE(0xD4, (bitSet<2, REGISTER_H>), 1, 8, 0, "SET 2,H") \
+	OPCODE(0xD5, (bitSet<2, REGISTER_L>), 1, 8, 0, "SET 2,L") \
+	OPCODE(0xD6, (bitSet<2, REGISTER_HL_ADDRESS>), 1, 16, 0, "SET 2,(HL)") \
+	OPCODE(0xD7, (bitSet<2, REGISTER_A>), 1, 8, 0, "SET 2,A") \
+	OPCODE(0xD8, (bitSet<3, REGISTER_B>), 1, 8, 0, "SET 3,B") \
+	OPCODE(0xD9, (bitSet<3, REGISTER_C>), 1, 8, 0, "SET 3,C") \
+	OPCODE(0xDA, (bitSet<3, REGISTER_D>), 1, 8, 0, "SET 3,D") \
+	OPCODE(0xDB, (bitSet<3, REGISTER_E>), 1, 8, 0, "SET 3,E") \
+	OPCODE(0xDC, (bitSet<3, REGISTER_H>), 1, 8, 0, "SET 3,H") \
+	OPCODE(0xDD, (bitSet<3, REGISTER_L>), 1, 8, 0, "SET 3,L") \
+	OPCODE(0xDE, (bitSet<3, REGISTER_HL_ADDRESS>), 1, 16, 0, "SET 3,(HL)") \
+	OPCODE(0xDF, (bitSet<3, REGISTER_A>), 1, 8, 0, "SET 3,A") \
+	OPCODE(0xE0, (bitSet<4, REGISTER_B>), 1, 8, 0, "SET 4,B") \
+	OPCODE(0xE1, (bitSet<4, REGISTER_C>), 1, 8, 0, "SET 4,C") \
+	OPCODE(0xE2, (bitSet<4, REGISTER_D>), 1, 8, 0, "SET 4,D") \
+	OPCODE(0xE3, (bitSet<4, REGISTER_E>), 1, 8, 0, "SET 4,E") \
+	OPCODE(0xE4, (bitSet<4, REGISTER_H>), 1, 8, 0, "SET 4,H") \
+	OPCODE(0xE5, (bitSet<4, REGISTER_L>), 1, 8, 0, "SET 4,L") \
+	OPCODE(0xE6, (bitSet<4, REGISTER_HL_ADDRESS>), 1, 16, 0, "SET 4,(HL)") \
+	OPCODE(0xE7, (bitSet<4, REGISTER_A>), 1, 8, 0, "SET 4,A") \
+	OPCODE(0xE8, (bitSet<5, REGISTER_B>), 1, 8, 0, "SET 5,B") \
+	OPCODE(0xE9, (bitSet<5, REGISTER_C>), 1, 8, 0, "SET 5,C") \
+	OPCODE(0xEA, (bitSet<5, REGISTER_D>), 1, 8, 0, "SET 5,D") \
+	OPCODE(0xEB, (bitSet<5, REGISTER_E>), 1, 8, 0, "SET 5,E") \
+	OPCODE(0xEC, (bitSet<5, REGISTER_H>), 1, 8, 0, "SET 5,H") \
+	OPCODE(0xED, (bitSet<5, REGISTER_L>), 1, 8, 0, "SET 5,L") \
+	OPCODE(0xEE, (bitSet<5, REGISTER_HL_ADDRESS>), 1, 16, 0, "SET 5,(HL)") \
+	OPCODE(0xEF, (bitSet<5, REGISTER_A>), 1, 8, 0, "SET 5,A") \
+	OPCODE(0xF0, (bitSet<6, REGISTER_B>), 1, 8, 0, "SET 6,B") \
+	OPCODE(0xF1, (bitSet<6, REGISTER_C>), 1, 8, 0, "SET 6,C") \
+	OPCODE(0xF2, (bitSet<6, REGISTER_D>), 1, 8, 0, "SET 6,D") \
+	OPCODE(0xF3, (bitSet<6, REGISTER_E>), 1, 8, 0, "SET 6,E") \
+	OPCODE(0xF4, (bitSet<6, REGISTER_H>), 1, 8, 0, "SET 6,H") \
+	OPCODE(0xF5, (bitSet<6, REGISTER_L>), 1, 8, 0, "SET 6,L") \
+	OPCODE(0xF6, (bitSet<6, REGISTER_HL_ADDRESS>), 1, 16, 0, "SET 6,(HL)") \
+	OPCODE(0xF7, (bitSet<6, REGISTER_A>), 1, 8, 0, "SET 6,A") \
+	OPCODE(0xF8, (bitSet<7, REGISTER_B>), 1, 8, 0, "SET 7,B") \
+	OPCODE(0xF9, (bitSet<7, REGISTER_C>), 1, 8, 0, "SET 7,C") \
+	OPCODE(0xFA, (bitSet<7, REGISTER_D>), 1, 8, 0, "SET 7,D") \
+	OPCODE(0xFB, (bitSet<7, REGISTER_E>), 1, 8, 0, "SET 7,E") \
+	OPCODE(0xFC, (bitSet<7, REGISTER_H>), 1, 8, 0, "SET 7,H") \
+	OPCODE(0xFD, (bitSet<7, REGISTER_L>), 1, 8, 0, "SET 7,L") \
+	OPCODE(0xFE, (bitSet<7, REGISTER_HL_ADDRESS>), 1, 16, 0, "SET 7,(HL)") \
+	OPCODE(0xFF, (bitSet<7, REGISTER_A>), 1, 8, 0, "SET 7,A")
+
+#define GGB_OPCODE_ENTRY(id, func, length, cycleCount, branchCycleCount, mnemonic) OPCodes::OPCode{ id, func, cycleCount, mnemonic, branchCycleCount, length },
+static constexpr std::array<OPCodes::OPCode, 256> opcodes = { GGB_OPCODE_TABLE(GGB_OPCODE_ENTRY) };
+static constexpr std::array<OPCodes::OPCode, 256> extendedOpcodes = { GGB_EXTENDED_OPCODE_TABLE(GGB_OPCODE_ENTRY) };
+#undef GGB_OPCODE_ENTRY
+
+static constexpr bool isOrderedByID(const std::array<OPCodes::OPCode, 256>& table)
+{
+	for (size_t i = 0; i < table.size(); ++i)
 	{
-		*branchTaken = true;
-		cpu->InstructionPointer() = popFromStack(cpu, bus);
+		if (table[i].id != static_cast<int>(i))
+			return false;
 	}
+	return true;
 }
 
-static void returnInstr(CPUInstructionParameters)
-{
-	cpu->InstructionPointer() = popFromStack(cpu, bus);
-}
+static_assert(isOrderedByID(opcodes), "The opcode table has to contain every opcode in ascending order");
+static_assert(isOrderedByID(extendedOpcodes), "The extended opcode table has to contain every opcode in ascending order");
 
-static void jumpZeroToNumber(CPUInstructionParameters)
+int OPCodes::execute(uint16_t opCode, ggb::CPUState* cpu, ggb::BUS* bus)
 {
-	const uint16_t bytes = readTwoBytes(cpu, bus);
-	if (cpu->getZeroFlag()) 
+	const OPCode* toExecute = nullptr;
+	if (opCode == 0xCB) 
 	{
-		*branchTaken = true;
-		cpu->InstructionPointer() = bytes;
+		auto extendedOpcode = read(cpu, bus);
+		toExecute = &extendedOpcodes[extendedOpcode];
+	}
+	else 
+	{
+		toExecute = &opcodes[opCode];
 	}
-}
 
-static void prefixOPCode(CPUInstructionParameters)
-{
-	assert(!"Should not be reachable");
-	// Will not be executed because we call the corresponding opcode of the extended opcodes
+	const uint16_t operand = readOperand(cpu, bus, toExecute->length);
+	const int cycles = toExecute->func(cpu, bus, operand);
+	assert(cycles == toExecute->baseCycleCount || cycles == toExecute->branchCycleCount);
+	return cycles;
 }
 
-static void callZeroNumber(CPUInstructionParameters)
-{
-	*branchTaken = cpu->getZeroFlag();
-	call(cpu, bus, *branchTaken);
-}
+#if defined(__GNUC__) || defined(__clang__)
+#define GGB_COMPUTED_GOTO
+#endif
 
-static void callInstr(CPUInstructionParameters)
+int OPCodes::executeThreaded(CPUState* cpu, BUS* bus, Scheduler* scheduler, uint64_t endCycle, const uint8_t* requestedInterrupts, const uint8_t* enabledInterrupts)
 {
-	call(cpu, bus, true);
+	int cycles = 0;
+	// The deadline is read again after every instruction, register writes can move it (or request a synchronization)
+	auto finished = [&]() 
+	{
+		return scheduler->getCurrentCycle() + cycles >= std::min(scheduler->getNextDeadline(), endCycle)
+			|| cpu->isStopped() || (cpu->interruptsEnabled() && (*requestedInterrupts & *enabledInterrupts));
+	};
+	auto advance = [&]()
+	{
+		scheduler->advance(cycles);
+		cycles = 0;
+	};
+
+#ifdef GGB_COMPUTED_GOTO
+#define GGB_LABEL_ADDRESS(id, func, length, cycleCount, branchCycleCount, mnemonic) &&opcode_##id,
+#define GGB_EXTENDED_LABEL_ADDRESS(id, func, length, cycleCount, branchCycleCount, mnemonic) &&extendedOpcode_##id,
+#define GGB_DISPATCH() \
+	if (finished()) \
+		return cycles; \
+	advance(); \
+	goto *dispatchTable[read(cpu, bus)];
+#define GGB_THREADED_OPCODE(id, func, length, cycleCount, branchCycleCount, mnemonic) \
+	opcode_##id: \
+	if constexpr (id == 0xCB) \
+		goto *extendedDispatchTable[read(cpu, bus)]; \
+	cycles += func(cpu, bus, readOperand(cpu, bus, length)); \
+	GGB_DISPATCH()
+#define GGB_THREADED_EXTENDED_OPCODE(id, func, length, cycleCount, branchCycleCount, mnemonic) \
+	extendedOpcode_##id: \
+	cycles += func(cpu, bus, 0); \
+	GGB_DISPATCH()
+
+	static const void* const dispatchTable[] = { GGB_OPCODE_TABLE(GGB_LABEL_ADDRESS) };
+	static const void* const extendedDispatchTable[] = { GGB_EXTENDED_OPCODE_TABLE(GGB_EXTENDED_LABEL_ADDRESS) };
+
+	goto *dispatchTable[read(cpu, bus)];
+	GGB_OPCODE_TABLE(GGB_THREADED_OPCODE)
+	GGB_EXTENDED_OPCODE_TABLE(GGB_THREADED_EXTENDED_OPCODE)
+
+#undef GGB_LABEL_ADDRESS
+#undef GGB_EXTENDED_LABEL_ADDRESS
+#undef GGB_DISPATCH
+#undef GGB_THREADED_OPCODE
+#undef GGB_THREADED_EXTENDED_OPCODE
+#else
+#define GGB_OPCODE_CASE(id, func, length, cycleCount, branchCycleCount, mnemonic) \
+	case id: \
+		cycles += func(cpu, bus, readOperand(cpu, bus, length)); \
+		break;
+
+	while (true)
+	{
+		const auto opCode = read(cpu, bus);
+		if (opCode == 0xCB) 
+		{
+			switch (read(cpu, bus))
+			{
+				GGB_EXTENDED_OPCODE_TABLE(GGB_OPCODE_CASE)
+			}
+		}
+		else
+		{
+			switch (opCode)
+			{
+				GGB_OPCODE_TABLE(GGB_OPCODE_CASE)
+			}
+		}
+
+		if (finished())
+			return cycles;
+		advance();
+	}
+#undef GGB_OPCODE_CASE
+#endif
 }
 
-static void addNumberAndCarryToA(CPUInstructionParameters)
+std::string_view OPCodes::getMnemonic(uint16_t opCode)
 {
-	add(cpu, cpu->A(), read(cpu, bus), cpu->getCarryFlag());
+	return opcodes[opCode].mnemonic;
 }
 
-static void restart08(CPUInstructionParameters)
+const OPCodes::OPCode& OPCodes::getOpcode(uint8_t opCode)
 {
-	restart(cpu, bus, 0x08);
+	return opcodes[opCode];
 }
 
-static void returnNotCarry(CPUInstructionParameters)
+const OPCodes::OPCode& OPCodes::getExtendedOpcode(uint8_t opCode)
 {
-	if (!cpu->getCarryFlag()) 
-	{
-		*branchTaken = true;
-		cpu->InstructionPointer() = popFromStack(cpu, bus);
-	}
-}
-
-static void popDE(CPUInstructionParameters)
-{
-	cpu->DE() = popFromStack(cpu, bus);
-}
-
-static void jumpNotCarryToNumber(CPUInstructionParameters)
-{
-	const uint16_t bytes = readTwoBytes(cpu, bus);
-	if (!cpu->getCarryFlag()) 
-	{
-		*branchTaken = true;
-		cpu->InstructionPointer() = bytes;
-	}
-}
-
-static void callNotCarryNumber(CPUInstructionParameters)
-{
-	*branchTaken = !cpu->getCarryFlag();
-	call(cpu, bus, *branchTaken);
-}
-
-static void pushDE(CPUInstructionParameters)
-{
-	pushOnStack(cpu, bus, cpu->DE());
-}
-
-static void subNumberFromA(CPUInstructionParameters)
-{
-	auto num = read(cpu, bus);
-	sub(cpu, cpu->A(), num);
-}
-
-static void restart10(CPUInstructionParameters)
-{
-	restart(cpu, bus, 0x10);
-}
-
-static void returnCarry(CPUInstructionParameters)
-{
-	if (cpu->getCarryFlag()) 
-	{
-		*branchTaken = true;
-		cpu->InstructionPointer() = popFromStack(cpu, bus);
-	}
-}
-
-static void enableInterrupts(CPUInstructionParameters)
-{
-	cpu->enableInterrupts();
-}
-
-static void returnFromInterruptHandler(CPUInstructionParameters)
-{
-	cpu->enableInterrupts();
-	returnInstr(cpu, bus, branchTaken);
-}
-
-static void jumpCarryToNumber(CPUInstructionParameters)
-{
-	const uint16_t bytes = readTwoBytes(cpu, bus);
-	if (cpu->getCarryFlag()) 
-	{
-		*branchTaken = true;
-		cpu->InstructionPointer() = bytes;
-	}
-}
-
-static void callCarryNumber(CPUInstructionParameters)
-{
-	*branchTaken = cpu->getCarryFlag();
-	call(cpu, bus, *branchTaken);
-}
-
-static void subtractNumberAndCarryFromA(CPUInstructionParameters)
-{
-	sub(cpu, cpu->A(), read(cpu, bus), cpu->getCarryFlag());
-}
-
-static void restart18(CPUInstructionParameters)
-{
-	restart(cpu, bus, 0x18);
-}
-
-static void loadAIntoSpecialAddressPlusNumber(CPUInstructionParameters)
-{
-	auto num = read(cpu, bus);
-	bus->write(0xFF00 + num, cpu->A());
-}
-
-static void POPHL(CPUInstructionParameters)
-{
-	cpu->HL() = popFromStack(cpu, bus);
-}
-
-static void loadAIntoSpecialAddressPlusC(CPUInstructionParameters)
-{
-	bus->write(0xFF00 + cpu->C(), cpu->A());
-}
-
-static void pushHL(CPUInstructionParameters)
-{
-	pushOnStack(cpu, bus, cpu->HL());
-}
-
-static void bitwiseAndAAndNumber(CPUInstructionParameters)
-{
-	auto num = read(cpu, bus);
-	bitwiseAnd(cpu, cpu->A(), num);
-}
-
-static void restart20(CPUInstructionParameters)
-{
-	restart(cpu, bus, 0x20);
-}
-
-static void addNumberToStackPointer(CPUInstructionParameters)
-{
-	add(cpu, cpu->StackPointer(), readSigned(cpu, bus));
-}
-
-static void jumpToHL(CPUInstructionParameters)
-{
-	cpu->InstructionPointer() = cpu->HL();
-}
-
-static void loadAIntoNumberAddress(CPUInstructionParameters)
-{
-	auto address = readTwoBytes(cpu, bus);
-	bus->write(address, cpu->A());
-}
-
-static void xorAAndNumber(CPUInstructionParameters)
-{
-	auto num = read(cpu, bus);
-	bitwiseXOR(cpu, cpu->A(), num);
-}
-
-static void restart28(CPUInstructionParameters)
-{
-	restart(cpu, bus, 0x28);
-}
-
-static void loadSpecialAddressPlusNumberIntoA(CPUInstructionParameters)
-{
-	auto num = read(cpu, bus);
-	cpu->A() = bus->read(0xFF00 + num);
-}
-
-static void POPAF(CPUInstructionParameters)
-{
-	cpu->AF() = popFromStack(cpu, bus);
-	cpu->F() &= 0xF0;
-}
-
-static void loadSpecialAddressPlusCIntoA(CPUInstructionParameters)
-{
-	cpu->A() = bus->read(0xFF00 + cpu->C());
-}
-
-static void disableInterrupts(CPUInstructionParameters)
-{
-	cpu->disableInterrupts();
-}
-
-static void pushAF(CPUInstructionParameters)
-{
-	pushOnStack(cpu, bus, cpu->AF());
-}
-
-static void bitwiseOrAAndNumber(CPUInstructionParameters)
-{
-	auto num = read(cpu, bus);
-	bitwiseOR(cpu, cpu->A(), num);
-}
-
-static void restart30(CPUInstructionParameters)
-{
-	restart(cpu, bus, 0x30);
-}
-
-static void loadStackPointerPlusNumberIntoHL(CPUInstructionParameters)
-{
-	auto sp = cpu->StackPointer();
-	const auto signedVal = readSigned(cpu, bus);
-	add(cpu, sp, signedVal);
-	cpu->HL() = sp;
-}
-
-static void loadHLIntoStackPointer(CPUInstructionParameters)
-{
-	cpu->StackPointer() = cpu->HL();
-}
-
-static void loadAddressIntoA(CPUInstructionParameters)
-{
-	auto address = readTwoBytes(cpu, bus);
-	cpu->A() = bus->read(address);
-}
-
-static void compareAWithNumber(CPUInstructionParameters)
-{
-	auto num = read(cpu, bus);
-	compare(cpu, cpu->A(), num);
-}
-
-static void restart38(CPUInstructionParameters)
-{
-	restart(cpu, bus, 0x38);
-}
-
-static void rotateBLeft(CPUInstructionParameters)
-{
-	rotateLeftSetZero(cpu, cpu->B());
-}
-
-static void rotateCLeft(CPUInstructionParameters)
-{
-	rotateLeftSetZero(cpu, cpu->C());
-}
-
-static void rotateDLeft(CPUInstructionParameters)
-{
-	rotateLeftSetZero(cpu, cpu->D());
-}
-
-static void rotateELeft(CPUInstructionParameters)
-{
-	rotateLeftSetZero(cpu, cpu->E());
-}
-
-static void rotateHLeft(CPUInstructionParameters)
-{
-	rotateLeftSetZero(cpu, cpu->H());
-}
-
-static void rotateLLeft(CPUInstructionParameters)
-{
-	rotateLeftSetZero(cpu, cpu->L());
-}
-
-static void rotateHLAddressLeft(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	rotateLeftSetZero(cpu, val);
-	bus->write(cpu->HL(), val);
-}
-
-static void rotateALeftSetZero(CPUInstructionParameters)
-{
-	rotateLeftSetZero(cpu, cpu->A());
-}
-
-static void rotateBRight(CPUInstructionParameters)
-{
-	rotateRightSetZero(cpu, cpu->B());
-}
-
-static void rotateCRight(CPUInstructionParameters)
-{
-	rotateRightSetZero(cpu, cpu->C());
-}
-
-static void rotateDRight(CPUInstructionParameters)
-{
-	rotateRightSetZero(cpu, cpu->D());
-}
-
-static void rotateERight(CPUInstructionParameters)
-{
-	rotateRightSetZero(cpu, cpu->E());
-}
-
-static void rotateHRight(CPUInstructionParameters)
-{
-	rotateRightSetZero(cpu, cpu->H());
-}
-
-static void rotateLRight(CPUInstructionParameters)
-{
-	rotateRightSetZero(cpu, cpu->L());
-}
-
-static void rotateHLAddressRight(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	rotateRightSetZero(cpu, val);
-	bus->write(cpu->HL(), val);
-}
-
-static void rotateARightSetZero(CPUInstructionParameters)
-{
-	rotateRightSetZero(cpu, cpu->A());
-}
-
-static void rotateBRightThroughCarry(CPUInstructionParameters)
-{
-	rotateRightThroughCarrySetZero(cpu, cpu->B());
-}
-
-static void rotateCRightThroughCarry(CPUInstructionParameters)
-{
-	rotateRightThroughCarrySetZero(cpu, cpu->C());
-}
-
-static void rotateDRightThroughCarry(CPUInstructionParameters)
-{
-	rotateRightThroughCarrySetZero(cpu, cpu->D());
-}
-
-static void rotateERightThroughCarry(CPUInstructionParameters)
-{
-	rotateRightThroughCarrySetZero(cpu, cpu->E());
-}
-
-static void rotateHRightThroughCarry(CPUInstructionParameters)
-{
-	rotateRightThroughCarrySetZero(cpu, cpu->H());
-}
-
-static void rotateLRightThroughCarry(CPUInstructionParameters)
-{
-	rotateRightThroughCarrySetZero(cpu, cpu->L());
-}
-
-static void rotateHLAddressRightThroughCarry(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	rotateRightThroughCarrySetZero(cpu, val);
-	bus->write(cpu->HL(), val);
-}
-
-static void rotateARightThroughCarrySetZero(CPUInstructionParameters)
-{
-	rotateRightThroughCarrySetZero(cpu, cpu->A());
-}
-
-static void rotateBLeftThroughCarry(CPUInstructionParameters)
-{
-	rotateLeftThroughCarrySetZero(cpu, cpu->B());
-}
-
-static void rotateCLeftThroughCarry(CPUInstructionParameters)
-{
-	rotateLeftThroughCarrySetZero(cpu, cpu->C());
-}
-
-static void rotateDLeftThroughCarry(CPUInstructionParameters)
-{
-	rotateLeftThroughCarrySetZero(cpu, cpu->D());
-}
-
-static void rotateELeftThroughCarry(CPUInstructionParameters)
-{
-	rotateLeftThroughCarrySetZero(cpu, cpu->E());
-}
-
-static void rotateHLeftThroughCarry(CPUInstructionParameters)
-{
-	rotateLeftThroughCarrySetZero(cpu, cpu->H());
-}
-
-static void rotateLLeftThroughCarry(CPUInstructionParameters)
-{
-	rotateLeftThroughCarrySetZero(cpu, cpu->L());
-}
-
-static void rotateHLAddressLeftThroughCarry(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	rotateLeftThroughCarrySetZero(cpu, val);
-	bus->write(cpu->HL(), val);
-}
-
-static void rotateALeftThroughCarrySetZero(CPUInstructionParameters)
-{
-	rotateLeftThroughCarrySetZero(cpu, cpu->A());
-}
-
-static void shiftBLeftArithmetically(CPUInstructionParameters)
-{
-	shiftLeftArithmetically(cpu, cpu->B());
-}
-
-static void shiftCLeftArithmetically(CPUInstructionParameters)
-{
-	shiftLeftArithmetically(cpu, cpu->C());
-}
-
-static void shiftDLeftArithmetically(CPUInstructionParameters)
-{
-	shiftLeftArithmetically(cpu, cpu->D());
-}
-
-static void shiftELeftArithmetically(CPUInstructionParameters)
-{
-	shiftLeftArithmetically(cpu, cpu->E());
-}
-
-static void shiftHLeftArithmetically(CPUInstructionParameters)
-{
-	shiftLeftArithmetically(cpu, cpu->H());
-}
-
-static void shiftLLeftArithmetically(CPUInstructionParameters)
-{
-	shiftLeftArithmetically(cpu, cpu->L());
-}
-
-static void shiftHLAddressLeftArithmetically(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	shiftLeftArithmetically(cpu, val);
-	bus->write(cpu->HL(), val);
-}
-
-static void shiftALeftArithmetically(CPUInstructionParameters)
-{
-	shiftLeftArithmetically(cpu, cpu->A());
-}
-
-static void shiftBRightArithmetically(CPUInstructionParameters)
-{
-	shiftRightArithmetically(cpu, cpu->B());
-}
-
-static void shiftCRightArithmetically(CPUInstructionParameters)
-{
-	shiftRightArithmetically(cpu, cpu->C());
-}
-
-static void shiftDRightArithmetically(CPUInstructionParameters)
-{
-	shiftRightArithmetically(cpu, cpu->D());
-}
-
-static void shiftERightArithmetically(CPUInstructionParameters)
-{
-	shiftRightArithmetically(cpu, cpu->E());
-}
-
-static void shiftHRightArithmetically(CPUInstructionParameters)
-{
-	shiftRightArithmetically(cpu, cpu->H());
-}
-
-static void shiftLRightArithmetically(CPUInstructionParameters)
-{
-	shiftRightArithmetically(cpu, cpu->L());
-}
-
-static void shiftHLAddressRightArithmetically(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	shiftRightArithmetically(cpu, val);
-	bus->write(cpu->HL(), val);
-}
-
-static void shiftARightArithmetically(CPUInstructionParameters)
-{
-	shiftRightArithmetically(cpu, cpu->A());
-}
-
-
-
-
-static void swapB(CPUInstructionParameters)
-{
-	swap(cpu, cpu->B());
-}
-
-static void swapC(CPUInstructionParameters)
-{
-	swap(cpu, cpu->C());
-}
-
-static void swapD(CPUInstructionParameters)
-{
-	swap(cpu, cpu->D());
-}
-
-static void swapE(CPUInstructionParameters)
-{
-	swap(cpu, cpu->E());
-}
-
-static void swapH(CPUInstructionParameters)
-{
-	swap(cpu, cpu->H());
-}
-
-static void swapL(CPUInstructionParameters)
-{
-	swap(cpu, cpu->L());
-}
-
-static void swapHLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	swap(cpu, val);
-	bus->write(cpu->HL(), val);
-}
-
-static void swapA(CPUInstructionParameters)
-{
-	swap(cpu, cpu->A());
-}
-
-static void shiftBRightLogically(CPUInstructionParameters)
-{
-	shiftRightLogically(cpu, cpu->B());
-}
-
-static void shiftCRightLogically(CPUInstructionParameters)
-{
-	shiftRightLogically(cpu, cpu->C());
-}
-
-static void shiftDRightLogically(CPUInstructionParameters)
-{
-	shiftRightLogically(cpu, cpu->D());
-}
-
-static void shiftERightLogically(CPUInstructionParameters)
-{
-	shiftRightLogically(cpu, cpu->E());
-}
-
-static void shiftHRightLogically(CPUInstructionParameters)
-{
-	shiftRightLogically(cpu, cpu->H());
-}
-
-static void shiftLRightLogically(CPUInstructionParameters)
-{
-	shiftRightLogically(cpu, cpu->L());
-}
-
-static void shiftHLAddressRightLogically(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	shiftRightLogically(cpu, val);
-	bus->write(cpu->HL(), val);
-}
-
-static void shiftARightLogically(CPUInstructionParameters)
-{
-	shiftRightLogically(cpu, cpu->A());
-}
-
-static void checkBit0A(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->A(), ggb::BIT0);
-}
-
-static void checkBit1A(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->A(), ggb::BIT1);
-}
-
-static void checkBit2A(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->A(), ggb::BIT2);
-}
-
-static void checkBit3A(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->A(), ggb::BIT3);
-}
-
-static void checkBit4A(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->A(), ggb::BIT4);
-}
-
-static void checkBit5A(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->A(), ggb::BIT5);
-}
-
-static void checkBit6A(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->A(), ggb::BIT6);
-}
-
-static void checkBit7A(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->A(), ggb::BIT7);
-}
-
-static void checkBit0B(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->B(), ggb::BIT0);
-}
-
-static void checkBit1B(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->B(), ggb::BIT1);
-}
-
-static void checkBit2B(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->B(), ggb::BIT2);
-}
-
-static void checkBit3B(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->B(), ggb::BIT3);
-}
-
-static void checkBit4B(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->B(), ggb::BIT4);
-}
-
-static void checkBit5B(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->B(), ggb::BIT5);
-}
-
-static void checkBit6B(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->B(), ggb::BIT6);
-}
-
-static void checkBit7B(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->B(), ggb::BIT7);
-}
-
-static void checkBit0C(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->C(), ggb::BIT0);
-}
-
-static void checkBit1C(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->C(), ggb::BIT1);
-}
-
-static void checkBit2C(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->C(), ggb::BIT2);
-}
-
-static void checkBit3C(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->C(), ggb::BIT3);
-}
-
-static void checkBit4C(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->C(), ggb::BIT4);
-}
-
-static void checkBit5C(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->C(), ggb::BIT5);
-}
-
-static void checkBit6C(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->C(), ggb::BIT6);
-}
-
-static void checkBit7C(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->C(), ggb::BIT7);
-}
-
-
-static void checkBit0D(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->D(), ggb::BIT0);
-}
-
-static void checkBit1D(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->D(), ggb::BIT1);
-}
-
-static void checkBit2D(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->D(), ggb::BIT2);
-}
-
-static void checkBit3D(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->D(), ggb::BIT3);
-}
-
-static void checkBit4D(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->D(), ggb::BIT4);
-}
-
-static void checkBit5D(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->D(), ggb::BIT5);
-}
-
-static void checkBit6D(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->D(), ggb::BIT6);
-}
-
-static void checkBit7D(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->D(), ggb::BIT7);
-}
-
-static void checkBit0E(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->E(), ggb::BIT0);
-}
-
-static void checkBit1E(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->E(), ggb::BIT1);
-}
-
-static void checkBit2E(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->E(), ggb::BIT2);
-}
-
-static void checkBit3E(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->E(), ggb::BIT3);
-}
-
-static void checkBit4E(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->E(), ggb::BIT4);
-}
-
-static void checkBit5E(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->E(), ggb::BIT5);
-}
-
-static void checkBit6E(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->E(), ggb::BIT6);
-}
-
-static void checkBit7E(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->E(), ggb::BIT7);
-}
-
-static void checkBit0H(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->H(), ggb::BIT0);
-}
-
-static void checkBit1H(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->H(), ggb::BIT1);
-}
-
-static void checkBit2H(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->H(), ggb::BIT2);
-}
-
-static void checkBit3H(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->H(), ggb::BIT3);
-}
-
-static void checkBit4H(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->H(), ggb::BIT4);
-}
-
-static void checkBit5H(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->H(), ggb::BIT5);
-}
-
-static void checkBit6H(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->H(), ggb::BIT6);
-}
-
-static void checkBit7H(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->H(), ggb::BIT7);
-}
-
-static void checkBit0L(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->L(), ggb::BIT0);
-}
-
-static void checkBit1L(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->L(), ggb::BIT1);
-}
-
-static void checkBit2L(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->L(), ggb::BIT2);
-}
-
-static void checkBit3L(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->L(), ggb::BIT3);
-}
-
-static void checkBit4L(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->L(), ggb::BIT4);
-}
-
-static void checkBit5L(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->L(), ggb::BIT5);
-}
-
-static void checkBit6L(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->L(), ggb::BIT6);
-}
-
-static void checkBit7L(CPUInstructionParameters)
-{
-	checkBit(cpu, cpu->L(), ggb::BIT7);
-}
-
-static void checkBit0HLAddress(CPUInstructionParameters)
-{
-	checkBit(cpu, bus->read(cpu->HL()), ggb::BIT0);
-}
-
-static void checkBit1HLAddress(CPUInstructionParameters)
-{
-	checkBit(cpu, bus->read(cpu->HL()), ggb::BIT1);
-}
-
-static void checkBit2HLAddress(CPUInstructionParameters)
-{
-	checkBit(cpu, bus->read(cpu->HL()), ggb::BIT2);
-}
-
-static void checkBit3HLAddress(CPUInstructionParameters)
-{
-	checkBit(cpu, bus->read(cpu->HL()), ggb::BIT3);
-}
-
-static void checkBit4HLAddress(CPUInstructionParameters)
-{
-	checkBit(cpu, bus->read(cpu->HL()), ggb::BIT4);
-}
-
-static void checkBit5HLAddress(CPUInstructionParameters)
-{
-	checkBit(cpu, bus->read(cpu->HL()), ggb::BIT5);
-}
-
-static void checkBit6HLAddress(CPUInstructionParameters)
-{
-	checkBit(cpu, bus->read(cpu->HL()), ggb::BIT6);
-}
-
-static void checkBit7HLAddress(CPUInstructionParameters)
-{
-	checkBit(cpu, bus->read(cpu->HL()), ggb::BIT7);
-}
-
-static void resetBit0A(CPUInstructionParameters)
-{
-	clearBit<0>(cpu->A());
-}
-
-static void resetBit1A(CPUInstructionParameters)
-{
-	clearBit<1>(cpu->A());
-}
-
-static void resetBit2A(CPUInstructionParameters)
-{
-	clearBit<2>(cpu->A());
-}
-
-static void resetBit3A(CPUInstructionParameters)
-{
-	clearBit<3>(cpu->A());
-}
-
-static void resetBit4A(CPUInstructionParameters)
-{
-	clearBit<4>(cpu->A());
-}
-
-static void resetBit5A(CPUInstructionParameters)
-{
-	clearBit<5>(cpu->A());
-}
-
-static void resetBit6A(CPUInstructionParameters)
-{
-	clearBit<6>(cpu->A());
-}
-
-static void resetBit7A(CPUInstructionParameters)
-{
-	clearBit<7>(cpu->A());
-}
-
-static void resetBit0B(CPUInstructionParameters)
-{
-	clearBit<0>(cpu->B());
-}
-
-static void resetBit1B(CPUInstructionParameters)
-{
-	clearBit<1>(cpu->B());
-}
-
-static void resetBit2B(CPUInstructionParameters)
-{
-	clearBit<2>(cpu->B());
-}
-
-static void resetBit3B(CPUInstructionParameters)
-{
-	clearBit<3>(cpu->B());
-}
-
-static void resetBit4B(CPUInstructionParameters)
-{
-	clearBit<4>(cpu->B());
-}
-
-static void resetBit5B(CPUInstructionParameters)
-{
-	clearBit<5>(cpu->B());
-}
-
-static void resetBit6B(CPUInstructionParameters)
-{
-	clearBit<6>(cpu->B());
-}
-
-static void resetBit7B(CPUInstructionParameters)
-{
-	clearBit<7>(cpu->B());
-}
-
-static void resetBit0C(CPUInstructionParameters)
-{
-	clearBit<0>(cpu->C());
-}
-
-static void resetBit1C(CPUInstructionParameters)
-{
-	clearBit<1>(cpu->C());
-}
-
-static void resetBit2C(CPUInstructionParameters)
-{
-	clearBit<2>(cpu->C());
-}
-
-static void resetBit3C(CPUInstructionParameters)
-{
-	clearBit<3>(cpu->C());
-}
-
-static void resetBit4C(CPUInstructionParameters)
-{
-	clearBit<4>(cpu->C());
-}
-
-static void resetBit5C(CPUInstructionParameters)
-{
-	clearBit<5>(cpu->C());
-}
-
-static void resetBit6C(CPUInstructionParameters)
-{
-	clearBit<6>(cpu->C());
-}
-
-static void resetBit7C(CPUInstructionParameters)
-{
-	clearBit<7>(cpu->C());
-}
-
-
-static void resetBit0D(CPUInstructionParameters)
-{
-	clearBit<0>(cpu->D());
-}
-
-static void resetBit1D(CPUInstructionParameters)
-{
-	clearBit<1>(cpu->D());
-}
-
-static void resetBit2D(CPUInstructionParameters)
-{
-	clearBit<2>(cpu->D());
-}
-
-static void resetBit3D(CPUInstructionParameters)
-{
-	clearBit<3>(cpu->D());
-}
-
-static void resetBit4D(CPUInstructionParameters)
-{
-	clearBit<4>(cpu->D());
-}
-
-static void resetBit5D(CPUInstructionParameters)
-{
-	clearBit<5>(cpu->D());
-}
-
-static void resetBit6D(CPUInstructionParameters)
-{
-	clearBit<6>(cpu->D());
-}
-
-static void resetBit7D(CPUInstructionParameters)
-{
-	clearBit<7>(cpu->D());
-}
-
-static void resetBit0E(CPUInstructionParameters)
-{
-	clearBit<0>(cpu->E());
-}
-
-static void resetBit1E(CPUInstructionParameters)
-{
-	clearBit<1>(cpu->E());
-}
-
-static void resetBit2E(CPUInstructionParameters)
-{
-	clearBit<2>(cpu->E());
-}
-
-static void resetBit3E(CPUInstructionParameters)
-{
-	clearBit<3>(cpu->E());
-}
-
-static void resetBit4E(CPUInstructionParameters)
-{
-	clearBit<4>(cpu->E());
-}
-
-static void resetBit5E(CPUInstructionParameters)
-{
-	clearBit<5>(cpu->E());
-}
-
-static void resetBit6E(CPUInstructionParameters)
-{
-	clearBit<6>(cpu->E());
-}
-
-static void resetBit7E(CPUInstructionParameters)
-{
-	clearBit<7>(cpu->E());
-}
-
-static void resetBit0H(CPUInstructionParameters)
-{
-	clearBit<0>(cpu->H());
-}
-
-static void resetBit1H(CPUInstructionParameters)
-{
-	clearBit<1>(cpu->H());
-}
-
-static void resetBit2H(CPUInstructionParameters)
-{
-	clearBit<2>(cpu->H());
-}
-
-static void resetBit3H(CPUInstructionParameters)
-{
-	clearBit<3>(cpu->H());
-}
-
-static void resetBit4H(CPUInstructionParameters)
-{
-	clearBit<4>(cpu->H());
-}
-
-static void resetBit5H(CPUInstructionParameters)
-{
-	clearBit<5>(cpu->H());
-}
-
-static void resetBit6H(CPUInstructionParameters)
-{
-	clearBit<6>(cpu->H());
-}
-
-static void resetBit7H(CPUInstructionParameters)
-{
-	clearBit<7>(cpu->H());
-}
-
-static void resetBit0L(CPUInstructionParameters)
-{
-	clearBit<0>(cpu->L());
-}
-
-static void resetBit1L(CPUInstructionParameters)
-{
-	clearBit<1>(cpu->L());
-}
-
-static void resetBit2L(CPUInstructionParameters)
-{
-	clearBit<2>(cpu->L());
-}
-
-static void resetBit3L(CPUInstructionParameters)
-{
-	clearBit<3>(cpu->L());
-}
-
-static void resetBit4L(CPUInstructionParameters)
-{
-	clearBit<4>(cpu->L());
-}
-
-static void resetBit5L(CPUInstructionParameters)
-{
-	clearBit<5>(cpu->L());
-}
-
-static void resetBit6L(CPUInstructionParameters)
-{
-	clearBit<6>(cpu->L());
-}
-
-static void resetBit7L(CPUInstructionParameters)
-{
-	clearBit<7>(cpu->L());
-}
-
-static void resetBit0HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	clearBit<0>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void resetBit1HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	clearBit<1>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void resetBit2HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	clearBit<2>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void resetBit3HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	clearBit<3>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void resetBit4HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	clearBit<4>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void resetBit5HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	clearBit<5>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void resetBit6HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	clearBit<6>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void resetBit7HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	clearBit<7>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void setBit0A(CPUInstructionParameters)
-{
-	setBit<0>(cpu->A());
-}
-
-static void setBit1A(CPUInstructionParameters)
-{
-	setBit<1>(cpu->A());
-}
-
-static void setBit2A(CPUInstructionParameters)
-{
-	setBit<2>(cpu->A());
-}
-
-static void setBit3A(CPUInstructionParameters)
-{
-	setBit<3>(cpu->A());
-}
-
-static void setBit4A(CPUInstructionParameters)
-{
-	setBit<4>(cpu->A());
-}
-
-static void setBit5A(CPUInstructionParameters)
-{
-	setBit<5>(cpu->A());
-}
-
-static void setBit6A(CPUInstructionParameters)
-{
-	setBit<6>(cpu->A());
-}
-
-static void setBit7A(CPUInstructionParameters)
-{
-	setBit<7>(cpu->A());
-}
-
-static void setBit0B(CPUInstructionParameters)
-{
-	setBit<0>(cpu->B());
-}
-
-static void setBit1B(CPUInstructionParameters)
-{
-	setBit<1>(cpu->B());
-}
-
-static void setBit2B(CPUInstructionParameters)
-{
-	setBit<2>(cpu->B());
-}
-
-static void setBit3B(CPUInstructionParameters)
-{
-	setBit<3>(cpu->B());
-}
-
-static void setBit4B(CPUInstructionParameters)
-{
-	setBit<4>(cpu->B());
-}
-
-static void setBit5B(CPUInstructionParameters)
-{
-	setBit<5>(cpu->B());
-}
-
-static void setBit6B(CPUInstructionParameters)
-{
-	setBit<6>(cpu->B());
-}
-
-static void setBit7B(CPUInstructionParameters)
-{
-	setBit<7>(cpu->B());
-}
-
-static void setBit0C(CPUInstructionParameters)
-{
-	setBit<0>(cpu->C());
-}
-
-static void setBit1C(CPUInstructionParameters)
-{
-	setBit<1>(cpu->C());
-}
-
-static void setBit2C(CPUInstructionParameters)
-{
-	setBit<2>(cpu->C());
-}
-
-static void setBit3C(CPUInstructionParameters)
-{
-	setBit<3>(cpu->C());
-}
-
-static void setBit4C(CPUInstructionParameters)
-{
-	setBit<4>(cpu->C());
-}
-
-static void setBit5C(CPUInstructionParameters)
-{
-	setBit<5>(cpu->C());
-}
-
-static void setBit6C(CPUInstructionParameters)
-{
-	setBit<6>(cpu->C());
-}
-
-static void setBit7C(CPUInstructionParameters)
-{
-	setBit<7>(cpu->C());
-}
-
-
-static void setBit0D(CPUInstructionParameters)
-{
-	setBit<0>(cpu->D());
-}
-
-static void setBit1D(CPUInstructionParameters)
-{
-	setBit<1>(cpu->D());
-}
-
-static void setBit2D(CPUInstructionParameters)
-{
-	setBit<2>(cpu->D());
-}
-
-static void setBit3D(CPUInstructionParameters)
-{
-	setBit<3>(cpu->D());
-}
-
-static void setBit4D(CPUInstructionParameters)
-{
-	setBit<4>(cpu->D());
-}
-
-static void setBit5D(CPUInstructionParameters)
-{
-	setBit<5>(cpu->D());
-}
-
-static void setBit6D(CPUInstructionParameters)
-{
-	setBit<6>(cpu->D());
-}
-
-static void setBit7D(CPUInstructionParameters)
-{
-	setBit<7>(cpu->D());
-}
-
-static void setBit0E(CPUInstructionParameters)
-{
-	setBit<0>(cpu->E());
-}
-
-static void setBit1E(CPUInstructionParameters)
-{
-	setBit<1>(cpu->E());
-}
-
-static void setBit2E(CPUInstructionParameters)
-{
-	setBit<2>(cpu->E());
-}
-
-static void setBit3E(CPUInstructionParameters)
-{
-	setBit<3>(cpu->E());
-}
-
-static void setBit4E(CPUInstructionParameters)
-{
-	setBit<4>(cpu->E());
-}
-
-static void setBit5E(CPUInstructionParameters)
-{
-	setBit<5>(cpu->E());
-}
-
-static void setBit6E(CPUInstructionParameters)
-{
-	setBit<6>(cpu->E());
-}
-
-static void setBit7E(CPUInstructionParameters)
-{
-	setBit<7>(cpu->E());
-}
-
-static void setBit0H(CPUInstructionParameters)
-{
-	setBit<0>(cpu->H());
-}
-
-static void setBit1H(CPUInstructionParameters)
-{
-	setBit<1>(cpu->H());
-}
-
-static void setBit2H(CPUInstructionParameters)
-{
-	setBit<2>(cpu->H());
-}
-
-static void setBit3H(CPUInstructionParameters)
-{
-	setBit<3>(cpu->H());
-}
-
-static void setBit4H(CPUInstructionParameters)
-{
-	setBit<4>(cpu->H());
-}
-
-static void setBit5H(CPUInstructionParameters)
-{
-	setBit<5>(cpu->H());
-}
-
-static void setBit6H(CPUInstructionParameters)
-{
-	setBit<6>(cpu->H());
-}
-
-static void setBit7H(CPUInstructionParameters)
-{
-	setBit<7>(cpu->H());
-}
-
-static void setBit0L(CPUInstructionParameters)
-{
-	setBit<0>(cpu->L());
-}
-
-static void setBit1L(CPUInstructionParameters)
-{
-	setBit<1>(cpu->L());
-}
-
-static void setBit2L(CPUInstructionParameters)
-{
-	setBit<2>(cpu->L());
-}
-
-static void setBit3L(CPUInstructionParameters)
-{
-	setBit<3>(cpu->L());
-}
-
-static void setBit4L(CPUInstructionParameters)
-{
-	setBit<4>(cpu->L());
-}
-
-static void setBit5L(CPUInstructionParameters)
-{
-	setBit<5>(cpu->L());
-}
-
-static void setBit6L(CPUInstructionParameters)
-{
-	setBit<6>(cpu->L());
-}
-
-static void setBit7L(CPUInstructionParameters)
-{
-	setBit<7>(cpu->L());
-}
-
-static void setBit0HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	setBit<0>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void setBit1HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	setBit<1>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void setBit2HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	setBit<2>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void setBit3HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	setBit<3>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void setBit4HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	setBit<4>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void setBit5HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	setBit<5>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void setBit6HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	setBit<6>(val);
-	bus->write(cpu->HL(), val);
-}
-
-static void setBit7HLAddress(CPUInstructionParameters)
-{
-	auto val = bus->read(cpu->HL());
-	setBit<7>(val);
-	bus->write(cpu->HL(), val);
-}
-
-
-
-
-
-
-
-void ggb::callAddress(CPUState* cpu, BUS* bus, uint16_t address)
-{
-	pushOnStack(cpu, bus, cpu->InstructionPointer());
-	cpu->InstructionPointer() = address;
-}
-
-ggb::OPCodes::OPCodes()
-{
-	initOpcodesArray();
-}
-
-int OPCodes::execute(uint16_t opCode, ggb::CPUState* cpu, ggb::BUS* bus) const
-{
-	const OPCode* toExecute = nullptr;
-	if (opCode == 0xCB) 
-	{
-		auto extendedOpcode = read(cpu, bus);
-		toExecute = &m_extendedOpcodes[extendedOpcode];
-	}
-	else 
-	{
-		toExecute = &m_opcodes[opCode];
-	}
-
-	bool branchTaken = false;
-	toExecute->func(cpu, bus, &branchTaken);
-
-	if (branchTaken) 
-	{
-		assert(toExecute->branchCycleCount != 0);
-		return toExecute->branchCycleCount;
-	}
-	return toExecute->baseCycleCount;
-}
-
-const std::string& OPCodes::getMnemonic(uint16_t opCode) const
-{
-	return m_opcodes[opCode].mnemonic;
-}
-
-void ggb::OPCodes::setOpcode(OPCode&& opcode)
-{
-	assert(opcode.id == m_counter);
-	m_opcodes[m_counter] = std::move(opcode);
-	++m_counter;
-}
-
-void ggb::OPCodes::setExtendedOpcode(OPCode&& opcode)
-{
-	assert(opcode.id == m_extendedOpcodeCounter);
-	m_extendedOpcodes[m_extendedOpcodeCounter] = std::move(opcode);
-	++m_extendedOpcodeCounter;
-}
-
-void ggb::OPCodes::initOpcodesArray()
-{
-	m_opcodes = std::vector<OPCode>(0xFF + 1);
-	m_extendedOpcodes = std::vector<OPCode>(0xFF + 1);
-
-	setOpcode({ 0x00, noop, 4, "NOP" });
-	setOpcode({ 0x01,loadBCValue, 12, "LD BC,u16" });
-	setOpcode({ 0x02,writeAToAddressBC, 8, "LD (BC),A" });
-	setOpcode({ 0x03,incrementBC, 8, "INC BC" });
-	setOpcode({ 0x04,incrementB, 4, "INC B" });
-	setOpcode({ 0x05,decrementB, 4, "DEC B" });
-	setOpcode({ 0x06,loadNumberIntoB, 8, "LD B,u8" });
-	setOpcode({ 0x07,rotateALeft, 4, "RLCA" });
-	setOpcode({ 0x08,loadStackPointerIntoAddress, 20 ,"LD (u16),SP" });
-	setOpcode({ 0x09,addBCToHL, 8 ,"ADD HL,BC" });
-	setOpcode({ 0x0A,loadValuePointedByBCIntoA, 8 ,"LD A,(BC)" });
-	setOpcode({ 0x0B,decrementBC, 8, "DEC BC" });
-	setOpcode({ 0x0C,incrementC, 4, "INC C" });
-	setOpcode({ 0x0D,decrementC, 4, "DEC C" });
-	setOpcode({ 0x0E,loadValueIntoC, 8, "LD C,u8" });
-	setOpcode({ 0x0F,rotateARight, 4, "RRCA" });
-	setOpcode({ 0x10,stop, 0, "STOP" });
-	setOpcode({ 0x11,loadTwoBytesIntoDE, 12, "LD DE,u16" });
-	setOpcode({ 0x12,writeAToAddressDE, 8, "LD (DE),A" });
-	setOpcode({ 0x13,incrementDE, 8, "INC DE" });
-	setOpcode({ 0x14,incrementD, 4, "INC D" });
-	setOpcode({ 0x15,decrementD, 4, "DEC D" });
-	setOpcode({ 0x16,loadValueIntoD, 8, "LD D,u8" });
-	setOpcode({ 0x17,rotateALeftThroughCarry, 4, "RLA" });
-	setOpcode({ 0x18,jumpRealativeToValue, 12, "JR i8" });
-	setOpcode({ 0x19,addDEToHL, 8, "ADD HL,DE" });
-	setOpcode({ 0x1A,loadValuePointedByDEIntoA, 8, "LD A,(DE)" });
-	setOpcode({ 0x1B,decrementDE, 8, "DEC DE" });
-	setOpcode({ 0x1C,incrementE, 4, "INC E" });
-	setOpcode({ 0x1D,decrementE, 4, "DEC E" });
-	setOpcode({ 0x1E,loadValueIntoE, 8, "LD E,u8" });
-	setOpcode({ 0x1F,rotateARightThroughCarry, 4, "RRA" });
-	setOpcode({ 0x20,jumpRelativeNotZeroToValue, 8, "JR NZ,i8", 12 });
-	setOpcode({ 0x21,loadTwoBytesIntoHL, 12, "LD HL,u16" });
-	setOpcode({ 0x22,loadAIntoHLAddressAndInc, 8, "LD (HL+),A" });
-	setOpcode({ 0x23,incrementHL, 8, "INC HL" });
-	setOpcode({ 0x24,incrementH, 4, "INC H" });
-	setOpcode({ 0x25,decrementH, 4, "DEC H" });
-	setOpcode({ 0x26,loadValueIntoH, 8, "LD H,u8" });
-	setOpcode({ 0x27,decimalAdjustAccumulator, 4, "DAA" });
-	setOpcode({ 0x28,jumpRealativeZeroToValue, 8, "JR Z,i8", 12 });
-	setOpcode({ 0x29,addHLToHL, 8, "ADD HL,HL" });
-	setOpcode({ 0x2A,loadHLAddressIntoAIncrementHL, 8, "LD A,(HL+)" });
-	setOpcode({ 0x2B,decrementHL, 8, "DEC HL" });
-	setOpcode({ 0x2C,incrementL, 4, "INC L" });
-	setOpcode({ 0x2D,decrementL, 4, "DEC L" });
-	setOpcode({ 0x2E,loadValueIntoL, 8, "LD L,u8" });
-	setOpcode({ 0x2F,complementAccumulator, 4, "CPL" });
-	setOpcode({ 0x30,jumpRelativeNotCarryToValue, 8, "JR NC,i8", 12 });
-	setOpcode({ 0x31,loadTwoBytesIntoStackPointer, 12, "LD SP,u16" });
-	setOpcode({ 0x32,loadAIntoHLAddressAndDec, 8, "LD (HL-),A" });
-	setOpcode({ 0x33,incrementSP, 8, "INC SP" });
-	setOpcode({ 0x34,incrementAddressHL, 12, "INC (HL)" });
-	setOpcode({ 0x35,decrementAddressHL, 12, "DEC (HL)" });
-	setOpcode({ 0x36,loadValueIntoAddressHL, 12, "LD (HL),u8" });
-	setOpcode({ 0x37,setCarryFlag, 4, "SCF" });
-	setOpcode({ 0x38,jumpRealativeCarryToValue, 8, "JR C,i8", 12 });
-	setOpcode({ 0x39,addSPToHL, 8, "ADD HL,SP" });
-	setOpcode({ 0x3A,loadHLAddressIntoADecrementHL, 8, "LD A,(HL-)" });
-	setOpcode({ 0x3B,decrementSP, 8, "DEC SP" });
-	setOpcode({ 0x3C,incrementA, 4, "INC A" });
-	setOpcode({ 0x3D,decrementA, 4, "DEC A" });
-	setOpcode({ 0x3E,loadValueIntoA, 8, "LD A,u8" });
-	setOpcode({ 0x3F,complementCarryFlag, 4, "CCF" });
-	setOpcode({ 0x40,loadBIntoB, 4, "LD B,B" });
-	setOpcode({ 0x41,loadCIntoB, 4, "LD B,C" });
-	setOpcode({ 0x42,loadDIntoB, 4, "LD B,D" });
-	setOpcode({ 0x43,loadEIntoB, 4, "LD B,E" });
-	setOpcode({ 0x44,loadHIntoB, 4, "LD B,H" });
-	setOpcode({ 0x45,loadLIntoB, 4, "LD B,L" });
-	setOpcode({ 0x46,loadAddressHLIntoB, 8, "LD B,(HL)" });
-	setOpcode({ 0x47,loadAIntoB, 4, "LD B,A" });
-	setOpcode({ 0x48,loadBIntoC, 4, "LD C,B" });
-	setOpcode({ 0x49,loadCIntoC, 4, "LD C,C" });
-	setOpcode({ 0x4A,loadDIntoC, 4, "LD C,D" });
-	setOpcode({ 0x4B,loadEIntoC, 4, "LD C,E" });
-	setOpcode({ 0x4C,loadHIntoC, 4, "LD C,H" });
-	setOpcode({ 0x4D,loadLIntoC, 4, "LD C,L" });
-	setOpcode({ 0x4E,loadHLAddressIntoC, 8, "LD C,(HL)" });
-	setOpcode({ 0x4F,loadAIntoC, 4, "LD C,A" });
-	setOpcode({ 0x50,loadBIntoD, 4, "LD D,B" });
-	setOpcode({ 0x51,loadCIntoD, 4, "LD D,C" });
-	setOpcode({ 0x52,loadDIntoD, 4, "LD D,D" });
-	setOpcode({ 0x53,loadEIntoD, 4, "LD D,E" });
-	setOpcode({ 0x54,loadHIntoD, 4, "LD D,H" });
-	setOpcode({ 0x55,loadLIntoD, 4, "LD D,L" });
-	setOpcode({ 0x56,loadHLAddressIntoD, 8, "LD D,(HL)" });
-	setOpcode({ 0x57,loadAIntoD, 4, "LD D,A" });
-	setOpcode({ 0x58,loadBIntoE, 4, "LD E,B" });
-	setOpcode({ 0x59,loadCIntoE, 4, "LD E,C" });
-	setOpcode({ 0x5A,loadDIntoE, 4, "LD E,D" });
-	setOpcode({ 0x5B,loadEIntoE, 4, "LD E,E" });
-	setOpcode({ 0x5C,loadHIntoE, 4, "LD E,H" });
-	setOpcode({ 0x5D,loadLIntoE, 4, "LD E,L" });
-	setOpcode({ 0x5E,loadAddressHLIntoE, 8, "LD E,(HL)" });
-	setOpcode({ 0x5F,loadAIntoE, 4, "LD E,A" });
-	setOpcode({ 0x60,loadBIntoH, 4, "LD H,B" });
-	setOpcode({ 0x61,loadCIntoH, 4, "LD H,C" });
-	setOpcode({ 0x62,loadDIntoH, 4, "LD H,D" });
-	setOpcode({ 0x63,loadEIntoH, 4, "LD H,E" });
-	setOpcode({ 0x64,loadHIntoH, 4, "LD H,H" });
-	setOpcode({ 0x65,loadLIntoH, 4, "LD H,L" });
-	setOpcode({ 0x66,loadAddressHLIntoH, 8, "LD H,(HL)" });
-	setOpcode({ 0x67,loadAIntoH, 4, "LD H,A" });
-	setOpcode({ 0x68,loadBIntoL, 4, "LD L,B" });
-	setOpcode({ 0x69,loadCIntoL, 4, "LD L,C" });
-	setOpcode({ 0x6A,loadDIntoL, 4, "LD L,D" });
-	setOpcode({ 0x6B,loadEIntoL, 4, "LD L,E" });
-	setOpcode({ 0x6C,loadHIntoL, 4, "LD L,H" });
-	setOpcode({ 0x6D,loadLIntoL, 4, "LD L,L" });
-	setOpcode({ 0x6E,loadAddressHLIntoL, 8, "LD L,(HL)" });
-	setOpcode({ 0x6F,loadAIntoL, 4, "LD L,A" });
-	setOpcode({ 0x70,loadBIntoHLAddress, 8, "LD (HL),B" });
-	setOpcode({ 0x71,loadCIntoHLAddress, 8, "LD (HL),C" });
-	setOpcode({ 0x72,loadDIntoHLAddress, 8, "LD (HL),D" });
-	setOpcode({ 0x73,loadEIntoHLAddress, 8, "LD (HL),E" });
-	setOpcode({ 0x74,loadHIntoHLAddress, 8, "LD (HL),H" });
-	setOpcode({ 0x75,loadLIntoHLAddress, 8, "LD (HL),L" });
-	setOpcode({ 0x76,halt, 0, "HALT" });
-	setOpcode({ 0x77,loadAIntoHLAddress, 8, "LD (HL),A" });
-	setOpcode({ 0x78,loadBIntoA, 4, "LD A,B" });
-	setOpcode({ 0x79,loadCIntoA, 4, "LD A,C" });
-	setOpcode({ 0x7A,loadDIntoA, 4, "LD A,D" });
-	setOpcode({ 0x7B,loadEIntoA, 4, "LD A,E" });
-	setOpcode({ 0x7C,loadHIntoA, 4, "LD A,H" });
-	setOpcode({ 0x7D,loadLIntoA, 4, "LD A,L" });
-	setOpcode({ 0x7E,loadAddressHLIntoA, 8, "LD A,(HL)" });
-	setOpcode({ 0x7F,loadAIntoA, 4, "LD A,A" });
-	setOpcode({ 0x80,addBToA, 4, "ADD A,B" });
-	setOpcode({ 0x81,addCToA, 4, "ADD A,C" });
-	setOpcode({ 0x82,addDToA, 4, "ADD A,D" });
-	setOpcode({ 0x83,addEToA, 4, "ADD A,E" });
-	setOpcode({ 0x84,addHToA, 4, "ADD A,H" });
-	setOpcode({ 0x85,addLToA, 4, "ADD A,L" });
-	setOpcode({ 0x86,addHLAddressToA, 8, "ADD A,(HL)" });
-	setOpcode({ 0x87,addAToA, 4, "ADD A,A" });
-	setOpcode({ 0x88,addBAndCarryToA, 4, "ADC A,B" });
-	setOpcode({ 0x89,addCAndCarryToA, 4, "ADC A,C" });
-	setOpcode({ 0x8A,addDAndCarryToA, 4, "ADC A,D" });
-	setOpcode({ 0x8B,addEAndCarryToA, 4, "ADC A,E" });
-	setOpcode({ 0x8C,addHAndCarryToA, 4, "ADC A,H" });
-	setOpcode({ 0x8D,addLAndCarryToA, 4, "ADC A,L" });
-	setOpcode({ 0x8E,addHLAddressAndCarryToA, 8, "ADC A,(HL)" });
-	setOpcode({ 0x8F,addAAndCarryToA, 4, "ADC A,A" });
-	setOpcode({ 0x90,subBFromA, 4, "SUB A,B" });
-	setOpcode({ 0x91,subCFromA, 4, "SUB A,C" });
-	setOpcode({ 0x92,subDFromA, 4, "SUB A,D" });
-	setOpcode({ 0x93,subEFromA, 4, "SUB A,E" });
-	setOpcode({ 0x94,subHFromA, 4, "SUB A,H" });
-	setOpcode({ 0x95,subLFromA, 4, "SUB A,L" });
-	setOpcode({ 0x96,subHLAddressFromA, 8, "SUB A,(HL)" });
-	setOpcode({ 0x97,subAFromA, 4, "SUB A,A" });
-	setOpcode({ 0x98,subBAndCarryFromA, 4, "SBC A,B" });
-	setOpcode({ 0x99,subCAndCarryFromA, 4, "SBC A,c" });
-	setOpcode({ 0x9A,subDAndCarryFromA, 4, "SBC A,D" });
-	setOpcode({ 0x9B,subEAndCarryFromA, 4, "SBC A,E" });
-	setOpcode({ 0x9C,subHAndCarryFromA, 4, "SBC A,H" });
-	setOpcode({ 0x9D,subLAndCarryFromA, 4, "SBC A,L" });
-	setOpcode({ 0x9E,subHLAddressAndCarryFromA, 8, "SBC A,(HL)" });
-	setOpcode({ 0x9F,subAAndCarryFromA, 4, "SBC A,A" });
-	setOpcode({ 0xA0,bitwiseAndAAndB, 4, "AND A,B" });
-	setOpcode({ 0xA1,bitwiseAndAAndC, 4, "AND A,C" });
-	setOpcode({ 0xA2,bitwiseAndAAndD, 4, "AND A,D" });
-	setOpcode({ 0xA3,bitwiseAndAAndE, 4, "AND A,E" });
-	setOpcode({ 0xA4,bitwiseAndAAndH, 4, "AND A,H" });
-	setOpcode({ 0xA5,bitwiseAndAAndL, 4, "AND A,L" });
-	setOpcode({ 0xA6,bitwiseAndAAndHLAddress, 8, "AND A,(HL)" });
-	setOpcode({ 0xA7,bitwiseAndAAndA, 4, "AND A,A" });
-	setOpcode({ 0xA8,bitwiseXORAAndB, 4, "XOR A,B" });
-	setOpcode({ 0xA9,bitwiseXORAAndC, 4, "XOR A,C" });
-	setOpcode({ 0xAA,bitwiseXORAAndD, 4, "XOR A,D" });
-	setOpcode({ 0xAB,bitwiseXORAAndE, 4, "XOR A,E" });
-	setOpcode({ 0xAC,bitwiseXORAAndH, 4, "XOR A,H" });
-	setOpcode({ 0xAD,bitwiseXORAAndL, 4, "XOR A,L" });
-	setOpcode({ 0xAE,bitwiseXORAAndHLAddress, 8, "XOR A,(HL)" });
-	setOpcode({ 0xAF,bitwiseXORAAndA, 4, "XOR A,A" });
-	setOpcode({ 0xB0,bitwiseORAAndB, 4, "OR A,B" });
-	setOpcode({ 0xB1,bitwiseORAAndC, 4, "OR A,C" });
-	setOpcode({ 0xB2,bitwiseORAAndD, 4, "OR A,D" });
-	setOpcode({ 0xB3,bitwiseORAAndE, 4, "OR A,E" });
-	setOpcode({ 0xB4,bitwiseORAAndH, 4, "OR A,H" });
-	setOpcode({ 0xB5,bitwiseORAAndL, 4, "OR A,L" });
-	setOpcode({ 0xB6,bitwiseORAAndHLAddress, 8, "OR A,(HL)" });
-	setOpcode({ 0xB7,bitwiseORAAndA, 4, "OR A,A" });
-	setOpcode({ 0xB8,compareAAndB, 4, "CP A,B" });
-	setOpcode({ 0xB9,compareAAndC, 4, "CP A,C" });
-	setOpcode({ 0xBA,compareAAndD, 4, "CP A,D" });
-	setOpcode({ 0xBB,compareAAndE, 4, "CP A,E" });
-	setOpcode({ 0xBC,compareAAndH, 4, "CP A,H" });
-	setOpcode({ 0xBD,compareAAndL, 4, "CP A,L" });
-	setOpcode({ 0xBE,compareAAndHLAddress, 8, "CP A,(HL)" });
-	setOpcode({ 0xBF,compareAAndA, 4, "CP A,A" });
-	setOpcode({ 0xC0,returnNotZero, 8, "RET NZ", 20 });
-	setOpcode({ 0xC1,popBC, 12, "POP BC" });
-	setOpcode({ 0xC2,jumpNotZeroToNumber, 12, "JP NZ,u16", 16 });
-	setOpcode({ 0xC3,jumpToNumber, 16, "JP u16" });
-	setOpcode({ 0xC4,callNotZeroNumber, 12, "CALL NZ,u16", 24 });
-	setOpcode({ 0xC5,pushBC, 16, "PUSH BC" });
-	setOpcode({ 0xC6,addNumberToA, 8, "ADD A,u8" });
-	setOpcode({ 0xC7,restart00, 16, "RST 00h" });
-	setOpcode({ 0xC8,returnZero, 8, "RET Z", 20 });
-	setOpcode({ 0xC9,returnInstr, 16, "RET" });
-	setOpcode({ 0xCA,jumpZeroToNumber, 12, "JP Z,u16", 16 });
-	setOpcode({ 0xCB,prefixOPCode, 0, "PREFIX CB" });
-	setOpcode({ 0xCC,callZeroNumber, 12, "CALL Z,u16", 24 });
-	setOpcode({ 0xCD,callInstr, 24, "CALL u16" });
-	setOpcode({ 0xCE,addNumberAndCarryToA, 8, "ADC A,u8" });
-	setOpcode({ 0xCF,restart08, 16, "RST 08h" });
-	setOpcode({ 0xD0,returnNotCarry, 8, "RET NC", 20 });
-	setOpcode({ 0xD1,popDE, 12, "POP DE" });
-	setOpcode({ 0xD2,jumpNotCarryToNumber, 12, "JP NC,u16", 16 });
-	setOpcode({ 0xD3,invalidInstruction, 0, "D3=INVALID" });
-	setOpcode({ 0xD4,callNotCarryNumber, 12, "CALL NC,u16", 24 });
-	setOpcode({ 0xD5,pushDE, 16, "PUSH DE" });
-	setOpcode({ 0xD6,subNumberFromA, 8, "SUB A,u8" });
-	setOpcode({ 0xD7,restart10, 16, "RST 10h" });
-	setOpcode({ 0xD8,returnCarry, 8, "RET C", 20 });
-	setOpcode({ 0xD9,returnFromInterruptHandler, 16, "RETI" });
-	setOpcode({ 0xDA,jumpCarryToNumber, 12, "JP C,u16", 16 });
-	setOpcode({ 0xDB,invalidInstruction, 0, "DB=INVALID" });
-	setOpcode({ 0xDC,callCarryNumber, 12, "CALL C,u16", 24 });
-	setOpcode({ 0xDD,invalidInstruction, 0, "DD=INVALID" });
-	setOpcode({ 0xDE,subtractNumberAndCarryFromA, 8, "SBC A,u8" });
-	setOpcode({ 0xDF,restart18, 16, "RST 18h" });
-	setOpcode({ 0xE0,loadAIntoSpecialAddressPlusNumber, 12, "LD (FF00+u8),A" });
-	setOpcode({ 0xE1,POPHL, 12, "POP HL" });
-	setOpcode({ 0xE2,loadAIntoSpecialAddressPlusC, 8, "LD (FF00+C),A" });
-	setOpcode({ 0xE3,invalidInstruction, 0, "E3=INVALID" });
-	setOpcode({ 0xE4,invalidInstruction, 0, "E4=INVALID" });
-	setOpcode({ 0xE5,pushHL, 16, "PUSH HL" });
-	setOpcode({ 0xE6,bitwiseAndAAndNumber, 8, "AND A,u8" });
-	setOpcode({ 0xE7,restart20, 16, "RST 20h" });
-	setOpcode({ 0xE8,addNumberToStackPointer, 16, "ADD SP,i8" });
-	setOpcode({ 0xE9,jumpToHL, 4, "JP HL" });
-	setOpcode({ 0xEA,loadAIntoNumberAddress, 16, "LD (u16),A" });
-	setOpcode({ 0xEB,invalidInstruction, 0, "EB=INVALID" });
-	setOpcode({ 0xEC,invalidInstruction, 0, "EC=INVALID" });
-	setOpcode({ 0xED,invalidInstruction, 0, "ED=INVALID" });
-	setOpcode({ 0xEE,xorAAndNumber, 8, "XOR A,u8" });
-	setOpcode({ 0xEF,restart28, 16, "RST 28h" });
-	setOpcode({ 0xF0,loadSpecialAddressPlusNumberIntoA, 12, "LD A,(FF00+u8)" });
-	setOpcode({ 0xF1,POPAF, 12, "POP AF" });
-	setOpcode({ 0xF2,loadSpecialAddressPlusCIntoA, 8, "LD A,(FF00+C)" });
-	setOpcode({ 0xF3,disableInterrupts, 4, "DI" });
-	setOpcode({ 0xF4,invalidInstruction, 0, "F4=INVALID" });
-	setOpcode({ 0xF5,pushAF, 16, "PUSH AF" });
-	setOpcode({ 0xF6,bitwiseOrAAndNumber, 8, "OR A,u8" });
-	setOpcode({ 0xF7,restart30, 16, "RST 30h" });
-	setOpcode({ 0xF8,loadStackPointerPlusNumberIntoHL, 12, "LD HL,SP+i8" });
-	setOpcode({ 0xF9,loadHLIntoStackPointer, 8, "LD SP,HL" });
-	setOpcode({ 0xFA,loadAddressIntoA, 16, "LD A,(u16)" });
-	setOpcode({ 0xFB,enableInterrupts, 4, "EI" });
-	setOpcode({ 0xFC,invalidInstruction, 0, "FC=INVALID" });
-	setOpcode({ 0xFD,invalidInstruction, 0, "FD=INVALID" });
-	setOpcode({ 0xFE,compareAWithNumber, 8, "CP A,u8" });
-	setOpcode({ 0xFF,restart38, 16, "RST 38h" });
-
-	// Extended OPcodes start
-	setExtendedOpcode({ 0x00,rotateBLeft, 8, "RLC B" });
-	setExtendedOpcode({ 0x01,rotateCLeft, 8, "RLC C" });
-	setExtendedOpcode({ 0x02,rotateDLeft, 8, "RLC D" });
-	setExtendedOpcode({ 0x03,rotateELeft, 8, "RLC E" });
-	setExtendedOpcode({ 0x04,rotateHLeft, 8, "RLC H" });
-	setExtendedOpcode({ 0x05,rotateLLeft, 8, "RLC L" });
-	setExtendedOpcode({ 0x06,rotateHLAddressLeft, 16, "RLC (HL)" });
-	setExtendedOpcode({ 0x07,rotateALeftSetZero, 8, "RLC A" });
-	setExtendedOpcode({ 0x08,rotateBRight, 8, "RRC B" });
-	setExtendedOpcode({ 0x09,rotateCRight, 8, "RRC C" });
-	setExtendedOpcode({ 0x0A,rotateDRight, 8, "RRC D" });
-	setExtendedOpcode({ 0x0B,rotateERight, 8, "RRC E" });
-	setExtendedOpcode({ 0x0C,rotateHRight, 8, "RRC H" });
-	setExtendedOpcode({ 0x0D,rotateLRight, 8, "RRC L" });
-	setExtendedOpcode({ 0x0E,rotateHLAddressRight, 16, "RRC (HL)" });
-	setExtendedOpcode({ 0x0F,rotateARightSetZero, 8, "RRC A" });
-	setExtendedOpcode({ 0x10,rotateBLeftThroughCarry, 8, "RL B" });
-	setExtendedOpcode({ 0x11,rotateCLeftThroughCarry, 8, "RL C" });
-	setExtendedOpcode({ 0x12,rotateDLeftThroughCarry, 8, "RL D" });
-	setExtendedOpcode({ 0x13,rotateELeftThroughCarry, 8, "RL E" });
-	setExtendedOpcode({ 0x14,rotateHLeftThroughCarry, 8, "RL H" });
-	setExtendedOpcode({ 0x15,rotateLLeftThroughCarry, 8, "RL L" });
-	setExtendedOpcode({ 0x16,rotateHLAddressLeftThroughCarry, 16, "RL (HL)" });
-	setExtendedOpcode({ 0x17,rotateALeftThroughCarrySetZero, 8, "RL A" });
-	setExtendedOpcode({ 0x18,rotateBRightThroughCarry, 8, "RR B" });
-	setExtendedOpcode({ 0x19,rotateCRightThroughCarry, 8, "RR C" });
-	setExtendedOpcode({ 0x1A,rotateDRightThroughCarry, 8, "RR D" });
-	setExtendedOpcode({ 0x1B,rotateERightThroughCarry, 8, "RR E" });
-	setExtendedOpcode({ 0x1C,rotateHRightThroughCarry, 8, "RR H" });
-	setExtendedOpcode({ 0x1D,rotateLRightThroughCarry, 8, "RR L" });
-	setExtendedOpcode({ 0x1E,rotateHLAddressRightThroughCarry, 16, "RR (HL)" });
-	setExtendedOpcode({ 0x1F,rotateARightThroughCarrySetZero, 8, "RR A" });
-	setExtendedOpcode({ 0x20,shiftBLeftArithmetically, 8, "SLA B" });
-	setExtendedOpcode({ 0x21,shiftCLeftArithmetically, 8, "SLA C" });
-	setExtendedOpcode({ 0x22,shiftDLeftArithmetically, 8, "SLA D" });
-	setExtendedOpcode({ 0x23,shiftELeftArithmetically, 8, "SLA E" });
-	setExtendedOpcode({ 0x24,shiftHLeftArithmetically, 8, "SLA H" });
-	setExtendedOpcode({ 0x25,shiftLLeftArithmetically, 8, "SLA L" });
-	setExtendedOpcode({ 0x26,shiftHLAddressLeftArithmetically, 16, "SLA (HL)" });
-	setExtendedOpcode({ 0x27,shiftALeftArithmetically, 8, "SLA A" });
-	setExtendedOpcode({ 0x28,shiftBRightArithmetically, 8, "SRA B" });
-	setExtendedOpcode({ 0x29,shiftCRightArithmetically, 8, "SRA C" });
-	setExtendedOpcode({ 0x2A,shiftDRightArithmetically, 8, "SRA D" });
-	setExtendedOpcode({ 0x2B,shiftERightArithmetically, 8, "SRA E" });
-	setExtendedOpcode({ 0x2C,shiftHRightArithmetically, 8, "SRA H" });
-	setExtendedOpcode({ 0x2D,shiftLRightArithmetically, 8, "SRA L" });
-	setExtendedOpcode({ 0x2E,shiftHLAddressRightArithmetically, 16, "SRA (HL)" });
-	setExtendedOpcode({ 0x2F,shiftARightArithmetically, 8, "SRA A" });
-	setExtendedOpcode({ 0x30,swapB, 8, "SWAP B" });
-	setExtendedOpcode({ 0x31,swapC, 8, "SWAP C" });
-	setExtendedOpcode({ 0x32,swapD, 8, "SWAP D" });
-	setExtendedOpcode({ 0x33,swapE, 8, "SWAP E" });
-	setExtendedOpcode({ 0x34,swapH, 8, "SWAP H" });
-	setExtendedOpcode({ 0x35,swapL, 8, "SWAP L" });
-	setExtendedOpcode({ 0x36,swapHLAddress, 16, "SWAP (HL)" });
-	setExtendedOpcode({ 0x37,swapA, 8, "SWAP A" });
-	setExtendedOpcode({ 0x38,shiftBRightLogically, 8, "SRL B" });
-	setExtendedOpcode({ 0x39,shiftCRightLogically, 8, "SRL C" });
-	setExtendedOpcode({ 0x3A,shiftDRightLogically, 8, "SRL D" });
-	setExtendedOpcode({ 0x3B,shiftERightLogically, 8, "SRL E" });
-	setExtendedOpcode({ 0x3C,shiftHRightLogically, 8, "SRL H" });
-	setExtendedOpcode({ 0x3D,shiftLRightLogically, 8, "SRL L" });
-	setExtendedOpcode({ 0x3E,shiftHLAddressRightLogically, 16, "SRL (HL)" });
-	setExtendedOpcode({ 0x3F,shiftARightLogically, 8, "SRL A" });
-	setExtendedOpcode({ 0x40,checkBit0B, 8, "BIT 0,B" });
-	setExtendedOpcode({ 0x41,checkBit0C, 8, "BIT 0,C" });
-	setExtendedOpcode({ 0x42,checkBit0D, 8, "BIT 0,D" });
-	setExtendedOpcode({ 0x43,checkBit0E, 8, "BIT 0,E" });
-	setExtendedOpcode({ 0x44,checkBit0H, 8, "BIT 0,H" });
-	setExtendedOpcode({ 0x45,checkBit0L, 8, "BIT 0,L" });
-	setExtendedOpcode({ 0x46,checkBit0HLAddress, 12, "BIT 0,(HL)" });
-	setExtendedOpcode({ 0x47,checkBit0A, 8, "BIT 0,A" });
-	setExtendedOpcode({ 0x48,checkBit1B, 8, "BIT 1,B" });
-	setExtendedOpcode({ 0x49,checkBit1C, 8, "BIT 1,C" });
-	setExtendedOpcode({ 0x4A,checkBit1D, 8, "BIT 1,D" });
-	setExtendedOpcode({ 0x4B,checkBit1E, 8, "BIT 1,E" });
-	setExtendedOpcode({ 0x4C,checkBit1H, 8, "BIT 1,H" });
-	setExtendedOpcode({ 0x4D,checkBit1L, 8, "BIT 1,L" });
-	setExtendedOpcode({ 0x4E,checkBit1HLAddress, 12, "BIT 1,(HL)" });
-	setExtendedOpcode({ 0x4F,checkBit1A, 8, "BIT 1,A" });
-	setExtendedOpcode({ 0x50,checkBit2B, 8, "BIT 2,B" });
-	setExtendedOpcode({ 0x51,checkBit2C, 8, "BIT 2,C" });
-	setExtendedOpcode({ 0x52,checkBit2D, 8, "BIT 2,D" });
-	setExtendedOpcode({ 0x53,checkBit2E, 8, "BIT 2,E" });
-	setExtendedOpcode({ 0x54,checkBit2H, 8, "BIT 2,H" });
-	setExtendedOpcode({ 0x55,checkBit2L, 8, "BIT 2,L" });
-	setExtendedOpcode({ 0x56,checkBit2HLAddress, 12, "BIT 2,(HL)" });
-	setExtendedOpcode({ 0x57,checkBit2A, 8, "BIT 2,A" });
-	setExtendedOpcode({ 0x58,checkBit3B, 8, "BIT 3,B" });
-	setExtendedOpcode({ 0x59,checkBit3C, 8, "BIT 3,C" });
-	setExtendedOpcode({ 0x5A,checkBit3D, 8, "BIT 3,D" });
-	setExtendedOpcode({ 0x5B,checkBit3E, 8, "BIT 3,E" });
-	setExtendedOpcode({ 0x5C,checkBit3H, 8, "BIT 3,H" });
-	setExtendedOpcode({ 0x5D,checkBit3L, 8, "BIT 3,L" });
-	setExtendedOpcode({ 0x5E,checkBit3HLAddress, 12, "BIT 3,(HL)" });
-	setExtendedOpcode({ 0x5F,checkBit3A, 8, "BIT 3,A" });
-	setExtendedOpcode({ 0x60,checkBit4B, 8, "BIT 4,B" });
-	setExtendedOpcode({ 0x61,checkBit4C, 8, "BIT 4,C" });
-	setExtendedOpcode({ 0x62,checkBit4D, 8, "BIT 4,D" });
-	setExtendedOpcode({ 0x63,checkBit4E, 8, "BIT 4,E" });
-	setExtendedOpcode({ 0x64,checkBit4H, 8, "BIT 4,H" });
-	setExtendedOpcode({ 0x65,checkBit4L, 8, "BIT 4,L" });
-	setExtendedOpcode({ 0x66,checkBit4HLAddress, 12, "BIT 4,(HL)" });
-	setExtendedOpcode({ 0x67,checkBit4A, 8, "BIT 4,A" });
-	setExtendedOpcode({ 0x68,checkBit5B, 8, "BIT 5,B" });
-	setExtendedOpcode({ 0x69,checkBit5C, 8, "BIT 5,C" });
-	setExtendedOpcode({ 0x6A,checkBit5D, 8, "BIT 5,D" });
-	setExtendedOpcode({ 0x6B,checkBit5E, 8, "BIT 5,E" });
-	setExtendedOpcode({ 0x6C,checkBit5H, 8, "BIT 5,H" });
-	setExtendedOpcode({ 0x6D,checkBit5L, 8, "BIT 5,L" });
-	setExtendedOpcode({ 0x6E,checkBit5HLAddress, 12, "BIT 5,(HL)" });
-	setExtendedOpcode({ 0x6F,checkBit5A, 8, "BIT 5,A" });
-	setExtendedOpcode({ 0x70,checkBit6B, 8, "BIT 6,B" });
-	setExtendedOpcode({ 0x71,checkBit6C, 8, "BIT 6,C" });
-	setExtendedOpcode({ 0x72,checkBit6D, 8, "BIT 6,D" });
-	setExtendedOpcode({ 0x73,checkBit6E, 8, "BIT 6,E" });
-	setExtendedOpcode({ 0x74,checkBit6H, 8, "BIT 6,H" });
-	setExtendedOpcode({ 0x75,checkBit6L, 8, "BIT 6,L" });
-	setExtendedOpcode({ 0x76,checkBit6HLAddress, 12, "BIT 6,(HL)" });
-	setExtendedOpcode({ 0x77,checkBit6A, 8, "BIT 6,A" });
-	setExtendedOpcode({ 0x78,checkBit7B, 8, "BIT 7,B" });
-	setExtendedOpcode({ 0x79,checkBit7C, 8, "BIT 7,C" });
-	setExtendedOpcode({ 0x7A,checkBit7D, 8, "BIT 7,D" });
-	setExtendedOpcode({ 0x7B,checkBit7E, 8, "BIT 7,E" });
-	setExtendedOpcode({ 0x7C,checkBit7H, 8, "BIT 7,H" });
-	setExtendedOpcode({ 0x7D,checkBit7L, 8, "BIT 7,L" });
-	setExtendedOpcode({ 0x7E,checkBit7HLAddress, 12, "BIT 7,(HL)" });
-	setExtendedOpcode({ 0x7F,checkBit7A, 8, "BIT 7,A" });
-	setExtendedOpcode({ 0x80,resetBit0B, 8, "RES 0,B" });
-	setExtendedOpcode({ 0x81,resetBit0C, 8, "RES 0,C" });
-	setExtendedOpcode({ 0x82,resetBit0D, 8, "RES 0,D" });
-	setExtendedOpcode({ 0x83,resetBit0E, 8, "RES 0,E" });
-	setExtendedOpcode({ 0x84,resetBit0H, 8, "RES 0,H" });
-	setExtendedOpcode({ 0x85,resetBit0L, 8, "RES 0,L" });
-	setExtendedOpcode({ 0x86,resetBit0HLAddress, 16, "RES 0,(HL)" });
-	setExtendedOpcode({ 0x87,resetBit0A, 8, "RES 0,A" });
-	setExtendedOpcode({ 0x88,resetBit1B, 8, "RES 1,B" });
-	setExtendedOpcode({ 0x89,resetBit1C, 8, "RES 1,C" });
-	setExtendedOpcode({ 0x8A,resetBit1D, 8, "RES 1,D" });
-	setExtendedOpcode({ 0x8B,resetBit1E, 8, "RES 1,E" });
-	setExtendedOpcode({ 0x8C,resetBit1H, 8, "RES 1,H" });
-	setExtendedOpcode({ 0x8D,resetBit1L, 8, "RES 1,L" });
-	setExtendedOpcode({ 0x8E,resetBit1HLAddress, 16, "RES 1,(HL)" });
-	setExtendedOpcode({ 0x8F,resetBit1A, 8, "RES 1,A" });
-	setExtendedOpcode({ 0x90,resetBit2B, 8, "RES 2,B" });
-	setExtendedOpcode({ 0x91,resetBit2C, 8, "RES 2,C" });
-	setExtendedOpcode({ 0x92,resetBit2D, 8, "RES 2,D" });
-	setExtendedOpcode({ 0x93,resetBit2E, 8, "RES 2,E" });
-	setExtendedOpcode({ 0x94,resetBit2H, 8, "RES 2,H" });
-	setExtendedOpcode({ 0x95,resetBit2L, 8, "RES 2,L" });
-	setExtendedOpcode({ 0x96,resetBit2HLAddress, 16, "RES 2,(HL)" });
-	setExtendedOpcode({ 0x97,resetBit2A, 8, "RES 2,A" });
-	setExtendedOpcode({ 0x98,resetBit3B, 8, "RES 3,B" });
-	setExtendedOpcode({ 0x99,resetBit3C, 8, "RES 3,C" });
-	setExtendedOpcode({ 0x9A,resetBit3D, 8, "RES 3,D" });
-	setExtendedOpcode({ 0x9B,resetBit3E, 8, "RES 3,E" });
-	setExtendedOpcode({ 0x9C,resetBit3H, 8, "RES 3,H" });
-	setExtendedOpcode({ 0x9D,resetBit3L, 8, "RES 3,L" });
-	setExtendedOpcode({ 0x9E,resetBit3HLAddress, 16, "RES 3,(HL)" });
-	setExtendedOpcode({ 0x9F,resetBit3A, 8, "RES 3,A" });
-	setExtendedOpcode({ 0xA0,resetBit4B, 8, "RES 4,B" });
-	setExtendedOpcode({ 0xA1,resetBit4C, 8, "RES 4,C" });
-	setExtendedOpcode({ 0xA2,resetBit4D, 8, "RES 4,D" });
-	setExtendedOpcode({ 0xA3,resetBit4E, 8, "RES 4,E" });
-	setExtendedOpcode({ 0xA4,resetBit4H, 8, "RES 4,H" });
-	setExtendedOpcode({ 0xA5,resetBit4L, 8, "RES 4,L" });
-	setExtendedOpcode({ 0xA6,resetBit4HLAddress, 16, "RES 4,(HL)" });
-	setExtendedOpcode({ 0xA7,resetBit4A, 8, "RES 4,A" });
-	setExtendedOpcode({ 0xA8,resetBit5B, 8, "RES 5,B" });
-	setExtendedOpcode({ 0xA9,resetBit5C, 8, "RES 5,C" });
-	setExtendedOpcode({ 0xAA,resetBit5D, 8, "RES 5,D" });
-	setExtendedOpcode({ 0xAB,resetBit5E, 8, "RES 5,E" });
-	setExtendedOpcode({ 0xAC,resetBit5H, 8, "RES 5,H" });
-	setExtendedOpcode({ 0xAD,resetBit5L, 8, "RES 5,L" });
-	setExtendedOpcode({ 0xAE,resetBit5HLAddress, 16, "RES 5,(HL)" });
-	setExtendedOpcode({ 0xAF,resetBit5A, 8, "RES 5,A" });
-	setExtendedOpcode({ 0xB0,resetBit6B, 8, "RES 6,B" });
-	setExtendedOpcode({ 0xB1,resetBit6C, 8, "RES 6,C" });
-	setExtendedOpcode({ 0xB2,resetBit6D, 8, "RES 6,D" });
-	setExtendedOpcode({ 0xB3,resetBit6E, 8, "RES 6,E" });
-	setExtendedOpcode({ 0xB4,resetBit6H, 8, "RES 6,H" });
-	setExtendedOpcode({ 0xB5,resetBit6L, 8, "RES 6,L" });
-	setExtendedOpcode({ 0xB6,resetBit6HLAddress, 16, "RES 6,(HL)" });
-	setExtendedOpcode({ 0xB7,resetBit6A, 8, "RES 6,A" });
-	setExtendedOpcode({ 0xB8,resetBit7B, 8, "RES 7,B" });
-	setExtendedOpcode({ 0xB9,resetBit7C, 8, "RES 7,C" });
-	setExtendedOpcode({ 0xBA,resetBit7D, 8, "RES 7,D" });
-	setExtendedOpcode({ 0xBB,resetBit7E, 8, "RES 7,E" });
-	setExtendedOpcode({ 0xBC,resetBit7H, 8, "RES 7,H" });
-	setExtendedOpcode({ 0xBD,resetBit7L, 8, "RES 7,L" });
-	setExtendedOpcode({ 0xBE,resetBit7HLAddress, 16, "RES 7,(HL)" });
-	setExtendedOpcode({ 0xBF,resetBit7A, 8, "RES 7,A" });
-	setExtendedOpcode({ 0xC0,setBit0B, 8, "SET 0,B" });
-	setExtendedOpcode({ 0xC1,setBit0C, 8, "SET 0,C" });
-	setExtendedOpcode({ 0xC2,setBit0D, 8, "SET 0,D" });
-	setExtendedOpcode({ 0xC3,setBit0E, 8, "SET 0,E" });
-	setExtendedOpcode({ 0xC4,setBit0H, 8, "SET 0,H" });
-	setExtendedOpcode({ 0xC5,setBit0L, 8, "SET 0,L" });
-	setExtendedOpcode({ 0xC6,setBit0HLAddress, 16, "SET 0,(HL)" });
-	setExtendedOpcode({ 0xC7,setBit0A, 8, "SET 0,A" });
-	setExtendedOpcode({ 0xC8,setBit1B, 8, "SET 1,B" });
-	setExtendedOpcode({ 0xC9,setBit1C, 8, "SET 1,C" });
-	setExtendedOpcode({ 0xCA,setBit1D, 8, "SET 1,D" });
-	setExtendedOpcode({ 0xCB,setBit1E, 8, "SET 1,E" });
-	setExtendedOpcode({ 0xCC,setBit1H, 8, "SET 1,H" });
-	setExtendedOpcode({ 0xCD,setBit1L, 8, "SET 1,L" });
-	setExtendedOpcode({ 0xCE,setBit1HLAddress, 16, "SET 1,(HL)" });
-	setExtendedOpcode({ 0xCF,setBit1A, 8, "SET 1,A" });
-	setExtendedOpcode({ 0xD0,setBit2B, 8, "SET 2,B" });
-	setExtendedOpcode({ 0xD1,setBit2C, 8, "SET 2,C" });
-	setExtendedOpcode({ 0xD2,setBit2D, 8, "SET 2,D" });
-	setExtendedOpcode({ 0xD3,setBit2E, 8, "SET 2,E" });
-	setExtendedOpcode({ 0xD4,setBit2H, 8, "SET 2,H" });
-	setExtendedOpcode({ 0xD5,setBit2L, 8, "SET 2,L" });
-	setExtendedOpcode({ 0xD6,setBit2HLAddress, 16, "SET 2,(HL)" });
-	setExtendedOpcode({ 0xD7,setBit2A, 8, "SET 2,A" });
-	setExtendedOpcode({ 0xD8,setBit3B, 8, "SET 3,B" });
-	setExtendedOpcode({ 0xD9,setBit3C, 8, "SET 3,C" });
-	setExtendedOpcode({ 0xDA,setBit3D, 8, "SET 3,D" });
-	setExtendedOpcode({ 0xDB,setBit3E, 8, "SET 3,E" });
-	setExtendedOpcode({ 0xDC,setBit3H, 8, "SET 3,H" });
-	setExtendedOpcode({ 0xDD,setBit3L, 8, "SET 3,L" });
-	setExtendedOpcode({ 0xDE,setBit3HLAddress, 16, "SET 3,(HL)" });
-	setExtendedOpcode({ 0xDF,setBit3A, 8, "SET 3,A" });
-	setExtendedOpcode({ 0xE0,setBit4B, 8, "SET 4,B" });
-	setExtendedOpcode({ 0xE1,setBit4C, 8, "SET 4,C" });
-	setExtendedOpcode({ 0xE2,setBit4D, 8, "SET 4,D" });
-	setExtendedOpcode({ 0xE3,setBit4E, 8, "SET 4,E" });
-	setExtendedOpcode({ 0xE4,setBit4H, 8, "SET 4,H" });
-	setExtendedOpcode({ 0xE5,setBit4L, 8, "SET 4,L" });
-	setExtendedOpcode({ 0xE6,setBit4HLAddress, 16, "SET 4,(HL)" });
-	setExtendedOpcode({ 0xE7,setBit4A, 8, "SET 4,A" });
-	setExtendedOpcode({ 0xE8,setBit5B, 8, "SET 5,B" });
-	setExtendedOpcode({ 0xE9,setBit5C, 8, "SET 5,C" });
-	setExtendedOpcode({ 0xEA,setBit5D, 8, "SET 5,D" });
-	setExtendedOpcode({ 0xEB,setBit5E, 8, "SET 5,E" });
-	setExtendedOpcode({ 0xEC,setBit5H, 8, "SET 5,H" });
-	setExtendedOpcode({ 0xED,setBit5L, 8, "SET 5,L" });
-	setExtendedOpcode({ 0xEE,setBit5HLAddress, 16, "SET 5,(HL)" });
-	setExtendedOpcode({ 0xEF,setBit5A, 8, "SET 5,A" });
-	setExtendedOpcode({ 0xF0,setBit6B, 8, "SET 6,B" });
-	setExtendedOpcode({ 0xF1,setBit6C, 8, "SET 6,C" });
-	setExtendedOpcode({ 0xF2,setBit6D, 8, "SET 6,D" });
-	setExtendedOpcode({ 0xF3,setBit6E, 8, "SET 6,E" });
-	setExtendedOpcode({ 0xF4,setBit6H, 8, "SET 6,H" });
-	setExtendedOpcode({ 0xF5,setBit6L, 8, "SET 6,L" });
-	setExtendedOpcode({ 0xF6,setBit6HLAddress, 16, "SET 6,(HL)" });
-	setExtendedOpcode({ 0xF7,setBit6A, 8, "SET 6,A" });
-	setExtendedOpcode({ 0xF8,setBit7B, 8, "SET 7,B" });
-	setExtendedOpcode({ 0xF9,setBit7C, 8, "SET 7,C" });
-	setExtendedOpcode({ 0xFA,setBit7D, 8, "SET 7,D" });
-	setExtendedOpcode({ 0xFB,setBit7E, 8, "SET 7,E" });
-	setExtendedOpcode({ 0xFC,setBit7H, 8, "SET 7,H" });
-	setExtendedOpcode({ 0xFD,setBit7L, 8, "SET 7,L" });
-	setExtendedOpcode({ 0xFE,setBit7HLAddress, 16, "SET 7,(HL)" });
-	setExtendedOpcode({ 0xFF,setBit7A, 8, "SET 7,A" });
+	return extendedOpcodes[opCode];
 }
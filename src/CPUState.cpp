@@ -10,6 +10,7 @@ uint8_t& ggb::CPUState::A()
 
 uint8_t& ggb::CPUState::F()
 {
+	materializeFlags();
 	return afUnion.regs[0];
 }
 
@@ -45,6 +46,7 @@ uint8_t& ggb::CPUState::L()
 
 uint16_t& ggb::CPUState::AF()
 {
+	materializeFlags();
 	return afUnion.AF;
 }
 
@@ -85,7 +87,17 @@ void ggb::CPUState::setZeroFlag(bool value)
 
 bool ggb::CPUState::getZeroFlag() const
 {
-	return isBitSet<7>(F());
+	switch (m_lazyFlags.operation)
+	{
+	case FlagOperation::NONE:
+		return isBitSet<7>(F());
+	case FlagOperation::ADD_16_BIT:
+		return m_lazyFlags.zero;
+	case FlagOperation::ROTATE_A:
+		return false;
+	default:
+		return static_cast<uint8_t>(m_lazyFlags.result) == 0;
+	}
 }
 
 void ggb::CPUState::setSubtractionFlag(bool value) 
@@ -95,8 +107,16 @@ void ggb::CPUState::setSubtractionFlag(bool value)
 
 bool ggb::CPUState::getSubtractionFlag() const
 {
-	return isBitSet<6>(F());
-
+	switch (m_lazyFlags.operation)
+	{
+	case FlagOperation::NONE:
+		return isBitSet<6>(F());
+	case FlagOperation::SUBTRACT:
+	case FlagOperation::DECREMENT:
+		return true;
+	default:
+		return false;
+	}
 }
 
 void ggb::CPUState::setHalfCarryFlag(bool value) 
@@ -106,7 +126,27 @@ void ggb::CPUState::setHalfCarryFlag(bool value)
 
 bool ggb::CPUState::getHalfCarryFlag() const
 {
-	return isBitSet<5>(F());
+	const auto& flags = m_lazyFlags;
+	switch (flags.operation)
+	{
+	case FlagOperation::NONE:
+		return isBitSet<5>(F());
+	case FlagOperation::ADD:
+		return ((flags.operand & 0xF) + (flags.operand2 & 0xF) + flags.carry) > 0xF;
+	case FlagOperation::SUBTRACT:
+		return (flags.operand & 0xF) < ((flags.operand2 & 0xF) + flags.carry);
+	case FlagOperation::INCREMENT:
+		return (flags.operand & 0xF) == 0xF;
+	case FlagOperation::DECREMENT:
+		return (flags.operand & 0xF) == 0x0;
+	case FlagOperation::ADD_16_BIT:
+		return ((flags.operand & 0xFFF) + (flags.operand2 & 0xFFF)) > 0xFFF;
+	case FlagOperation::AND:
+	case FlagOperation::BIT:
+		return true;
+	default:
+		return false;
+	}
 }
 
 void ggb::CPUState::setCarryFlag(bool value) 
@@ -116,7 +156,52 @@ void ggb::CPUState::setCarryFlag(bool value)
 
 bool ggb::CPUState::getCarryFlag() const
 {
-	return isBitSet<4>(F());
+	const auto& flags = m_lazyFlags;
+	switch (flags.operation)
+	{
+	case FlagOperation::NONE:
+		return isBitSet<4>(F());
+	case FlagOperation::ADD:
+		return flags.result > 0xFF;
+	case FlagOperation::SUBTRACT:
+		return flags.operand < (flags.operand2 + flags.carry);
+	case FlagOperation::ADD_16_BIT:
+		return flags.result > 0xFFFF;
+	case FlagOperation::AND:
+	case FlagOperation::OR:
+		return false;
+	default:
+		return flags.carry;
+	}
+}
+
+void ggb::CPUState::setFlagsFromOperation(FlagOperation operation, uint16_t operand, uint16_t operand2, uint32_t result, uint8_t carry)
+{
+	LazyFlags flags = { operation, carry, false, operand, operand2, result };
+	// Flags which are not affected by the operation need to be taken from the previous one
+	if (operation == FlagOperation::INCREMENT || operation == FlagOperation::DECREMENT || operation == FlagOperation::BIT)
+		flags.carry = getCarryFlag();
+	else if (operation == FlagOperation::ADD_16_BIT)
+		flags.zero = getZeroFlag();
+
+	m_lazyFlags = flags;
+#ifndef GGB_LAZY_FLAGS
+	materializeFlags();
+#endif
+}
+
+void ggb::CPUState::materializeFlags()
+{
+	if (m_lazyFlags.operation == FlagOperation::NONE)
+		return;
+
+	uint8_t flags = 0;
+	setBitToValue<7>(flags, getZeroFlag());
+	setBitToValue<6>(flags, getSubtractionFlag());
+	setBitToValue<5>(flags, getHalfCarryFlag());
+	setBitToValue<4>(flags, getCarryFlag());
+	afUnion.regs[0] = flags | (afUnion.regs[0] & 0x0F);
+	m_lazyFlags.operation = FlagOperation::NONE;
 }
 
 void ggb::CPUState::disableInterrupts()
@@ -151,6 +236,7 @@ bool ggb::CPUState::isStopped() const
 
 void ggb::CPUState::serialization(Serialization* serialization)
 {
+	materializeFlags();
 	serialization->read_write(afUnion);
 	serialization->read_write(bcUnion);
 	serialization->read_write(deUnion);
@@ -166,42 +252,33 @@ uint8_t ggb::CPUState::F() const
 	return afUnion.regs[0];
 }
 
-// TODO refactor setting of flags to being able to set multiple flags at once
 void ggb::increment(CPUState* cpu, uint8_t& toIncrement)
 {
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag((toIncrement & 0XF) == 0xF);
+	const uint8_t initialValue = toIncrement;
 	toIncrement++;
-	cpu->setZeroFlag(toIncrement == 0);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::INCREMENT, initialValue, 1, toIncrement);
 }
 
 void ggb::decrement(CPUState* cpu, uint8_t& toDecrement)
 {
-	cpu->setSubtractionFlag(true);
-	cpu->setHalfCarryFlag((toDecrement & 0XF) == 0x00);
+	const uint8_t initialValue = toDecrement;
 	--toDecrement;
-	cpu->setZeroFlag(toDecrement == 0);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::DECREMENT, initialValue, 1, toDecrement);
 }
 
 void ggb::add(CPUState* cpu, uint8_t& outNum, uint8_t num2)
 {
 	const uint8_t initialVal = outNum;
 	outNum += num2;
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag((outNum & 0xF) < (initialVal & 0xF));
-	cpu->setCarryFlag(outNum < initialVal);
-	cpu->setZeroFlag(outNum == 0);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::ADD, initialVal, num2, initialVal + num2);
 }
 
 void ggb::add(CPUState* cpu, uint8_t& outNum, uint8_t num2, uint8_t carryFlag)
 {
+	const uint8_t initialVal = outNum;
 	const uint32_t result = static_cast<int>(num2) + outNum + carryFlag;
-	const uint16_t lowerNibblesAdded = (outNum & 0xF) + (num2 & 0xF) + carryFlag;
 	outNum = static_cast<uint8_t>(result);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(lowerNibblesAdded > 0xF);
-	cpu->setCarryFlag(result > 0xFF);
-	cpu->setZeroFlag(outNum == 0);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::ADD, initialVal, num2, result, carryFlag);
 }
 
 // 16 bit addition is (as far as I know) composed of two 8 bit additions
@@ -210,13 +287,12 @@ void ggb::add(CPUState* cpu, uint16_t& outNum, uint16_t num2)
 {
 	const uint16_t initialVal = outNum;
 	outNum += num2;
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag((outNum & 0xFFF) < (initialVal & 0xFFF));
-	cpu->setCarryFlag(outNum < initialVal);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::ADD_16_BIT, initialVal, num2, static_cast<uint32_t>(initialVal) + num2);
 }
 
 void ggb::add(CPUState* cpu, uint16_t& outNum, int8_t num2)
 {
+	// Rarely used, therefore the flags are set directly
 	const auto initialVal = outNum;
 	outNum += num2;
 	if (num2 >= 0) 
@@ -237,21 +313,14 @@ void ggb::sub(CPUState* cpu, uint8_t& outReg, uint8_t reg2)
 {
 	const uint8_t initialValue = outReg;
 	outReg -= reg2;
-	cpu->setSubtractionFlag(true);
-	cpu->setHalfCarryFlag((outReg & 0xF) >(initialValue & 0xF));
-	cpu->setCarryFlag(outReg > initialValue);
-	cpu->setZeroFlag(outReg == 0);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SUBTRACT, initialValue, reg2, outReg);
 }
 
 void ggb::sub(CPUState* cpu, uint8_t& outNum, uint8_t num2, uint8_t carryFlag)
 {
-	const uint32_t result = outNum - num2 - carryFlag;
-	const uint32_t lowerNibblesSubtracted = (outNum & 0xF) - (num2 & 0xF) - carryFlag;
-	outNum = static_cast<uint8_t>(result);
-	cpu->setSubtractionFlag(true);
-	cpu->setHalfCarryFlag(lowerNibblesSubtracted > 0xF);
-	cpu->setCarryFlag(result > 0xFF);
-	cpu->setZeroFlag(outNum == 0);
+	const uint8_t initialValue = outNum;
+	outNum = static_cast<uint8_t>(outNum - num2 - carryFlag);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SUBTRACT, initialValue, num2, outNum, carryFlag);
 }
 
 void ggb::compare(CPUState* cpu, uint8_t num, uint8_t num2)
@@ -262,148 +331,113 @@ void ggb::compare(CPUState* cpu, uint8_t num, uint8_t num2)
 void ggb::bitwiseAnd(CPUState* cpu, uint8_t& outNum, uint8_t num2)
 {
 	outNum &= num2;
-	cpu->setCarryFlag(false);
-	cpu->setHalfCarryFlag(true);
-	cpu->setSubtractionFlag(false);
-	cpu->setZeroFlag(outNum == 0);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::AND, 0, 0, outNum);
 }
 
 void ggb::bitwiseOR(CPUState* cpu, uint8_t& outNum, uint8_t num2)
 {
 	outNum |= num2;
-	cpu->setCarryFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setSubtractionFlag(false);
-	cpu->setZeroFlag(outNum == 0);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::OR, 0, 0, outNum);
 }
 
 void ggb::bitwiseXOR(CPUState* cpu, uint8_t& outNum, uint8_t num2)
 {
 	outNum ^= num2;
-	cpu->setCarryFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setSubtractionFlag(false);
-	cpu->setZeroFlag(outNum == 0);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::OR, 0, 0, outNum);
 }
 
 void ggb::checkBit(CPUState* cpu, uint8_t num, int bit)
 {
 	const bool isSet = isBitSet(num, bit);
-	cpu->setHalfCarryFlag(true);
-	cpu->setSubtractionFlag(false);
-	cpu->setZeroFlag(!isSet);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::BIT, 0, 0, isSet);
 }
 
 void ggb::swap(CPUState* cpu, uint8_t& out)
 {
 	swap(out);
-	cpu->setZeroFlag(out == 0);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setCarryFlag(false);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::OR, 0, 0, out);
 }
 
-void ggb::rotateLeft(CPUState* cpu, uint8_t& outNum)
+// Returns the bit shifted out
+static bool rotateBitsLeft(uint8_t& out, bool bitToShiftIn)
 {
-	const bool carry = isBitSet<7>(outNum);
-	cpu->setZeroFlag(false);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setCarryFlag(carry);
+	const bool carry = ggb::isBitSet<7>(out);
 	// TODO if upgrade to C++ 20 is made, use the std::rot functions
-	outNum = outNum << 1;
-	setBitToValue<0>(outNum, carry);
+	out = out << 1;
+	ggb::setBitToValue<0>(out, bitToShiftIn);
+	return carry;
+}
+
+static bool rotateBitsRight(uint8_t& out, bool bitToShiftIn)
+{
+	const bool carry = ggb::isBitSet<0>(out);
+	out = out >> 1;
+	ggb::setBitToValue<7>(out, bitToShiftIn);
+	return carry;
+}
+
+void ggb::rotateLeft(CPUState* cpu, uint8_t& outNum)
+{
+	const bool carry = rotateBitsLeft(outNum, isBitSet<7>(outNum));
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::ROTATE_A, 0, 0, outNum, carry);
 }
 
 void ggb::rotateLeftThroughCarry(CPUState* cpu, uint8_t& out)
 {
-	const bool oldCarry = cpu->getCarryFlag();
-	const bool carry = isBitSet<7>(out);
-	cpu->setZeroFlag(false);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setCarryFlag(static_cast<bool>(carry));
-	out = out << 1;
-	setBitToValue<0>(out, oldCarry);
+	const bool carry = rotateBitsLeft(out, cpu->getCarryFlag());
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::ROTATE_A, 0, 0, out, carry);
 }
 
 void ggb::rotateLeftSetZero(CPUState* cpu, uint8_t& out)
 {
-	rotateLeft(cpu, out);
-	cpu->setZeroFlag(out == 0);
+	const bool carry = rotateBitsLeft(out, isBitSet<7>(out));
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SHIFT, 0, 0, out, carry);
 }
 
 void ggb::rotateLeftThroughCarrySetZero(CPUState* cpu, uint8_t& out)
 {
-	rotateLeftThroughCarry(cpu, out);
-	cpu->setZeroFlag(out == 0);
+	const bool carry = rotateBitsLeft(out, cpu->getCarryFlag());
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SHIFT, 0, 0, out, carry);
 }
 
 void ggb::shiftLeftArithmetically(CPUState* cpu, uint8_t& out)
 {
-	const bool carry = isBitSet<7>(out);
-	out = out << 1;
-	cpu->setZeroFlag(out == 0);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setCarryFlag(carry);
+	const bool carry = rotateBitsLeft(out, false);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SHIFT, 0, 0, out, carry);
 }
 
 void ggb::rotateRight(CPUState* cpu, uint8_t& out)
 {
-	const bool carry = isBitSet<0>(out);
-	cpu->setZeroFlag(false);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setCarryFlag(carry);
-	out = out >> 1;
-	setBitToValue<7>(out, carry);
+	const bool carry = rotateBitsRight(out, isBitSet<0>(out));
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::ROTATE_A, 0, 0, out, carry);
 }
 
 void ggb::rotateRightThroughCarry(CPUState* cpu, uint8_t& out)
 {
-	const bool oldCarry = cpu->getCarryFlag();
-	const bool carry = isBitSet<0>(out);
-	cpu->setZeroFlag(false);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setCarryFlag(carry);
-	out = out >> 1;
-	setBitToValue<7>(out, oldCarry);
+	const bool carry = rotateBitsRight(out, cpu->getCarryFlag());
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::ROTATE_A, 0, 0, out, carry);
 }
 
 void ggb::rotateRightSetZero(CPUState* cpu, uint8_t& out)
 {
-	rotateRight(cpu, out);
-	cpu->setZeroFlag(out == 0);
+	const bool carry = rotateBitsRight(out, isBitSet<0>(out));
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SHIFT, 0, 0, out, carry);
 }
 
 void ggb::rotateRightThroughCarrySetZero(CPUState* cpu, uint8_t& out)
 {
-	rotateRightThroughCarry(cpu, out);
-	cpu->setZeroFlag(out == 0);
+	const bool carry = rotateBitsRight(out, cpu->getCarryFlag());
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SHIFT, 0, 0, out, carry);
 }
 
 void ggb::shiftRightArithmetically(CPUState* cpu, uint8_t& out)
 {
-	const bool carry = isBitSet<0>(out);
-	const bool upperBit = isBitSet<7>(out);
-
-	out = out >> 1;
-	cpu->setZeroFlag(out == 0);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setCarryFlag(carry);
-	setBitToValue<7>(out, upperBit);
+	const bool carry = rotateBitsRight(out, isBitSet<7>(out));
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SHIFT, 0, 0, out, carry);
 }
 
 void ggb::shiftRightLogically(CPUState* cpu, uint8_t& out)
 {
-	const bool carry = isBitSet<0>(out);
-
-	out = out >> 1;
-	cpu->setZeroFlag(out == 0);
-	cpu->setSubtractionFlag(false);
-	cpu->setHalfCarryFlag(false);
-	cpu->setCarryFlag(carry);
+	const bool carry = rotateBitsRight(out, false);
+	cpu->setFlagsFromOperation(CPUState::FlagOperation::SHIFT, 0, 0, out, carry);
 }
@@ -30,6 +30,7 @@ bool ggb::Cartridge::load(const std::filesystem::path& romPath)
 	m_mbcType = getMBCType(cartridgeData);
 	m_memoryBankController = createMemoryBankController(m_mbcType);
 	m_memoryBankController->initialize(std::move(cartridgeData));
+	m_memoryBankController->updateMappedBanks();
 
 	return true;
 }
@@ -37,6 +38,8 @@ bool ggb::Cartridge::load(const std::filesystem::path& romPath)
 void ggb::Cartridge::write(uint16_t address, uint8_t value)
 {
 	m_memoryBankController->write(address, value);
+	if (isCartridgeROMAddress(address)) // Bank selection
+		m_memoryBankController->updateMappedBanks();
 }
 
 uint8_t ggb::Cartridge::read(uint16_t address) const
@@ -44,6 +47,16 @@ uint8_t ggb::Cartridge::read(uint16_t address) const
 	return m_memoryBankController->read(address);
 }
 
+int ggb::Cartridge::getROMBankNumber() const
+{
+	return m_memoryBankController->getROMBankNumber();
+}
+
+const MappedBanks& ggb::Cartridge::getMappedBanks() const
+{
+	return m_memoryBankController->getMappedBanks();
+}
+
 void ggb::Cartridge::serialize(Serialization* serialize)
 {
 	serialization(serialize);
@@ -55,6 +68,7 @@ void ggb::Cartridge::deserialize(Serialization* deserialize)
 	serialization(deserialize);
 	m_memoryBankController = createMemoryBankController(m_mbcType);
 	m_memoryBankController->serialization(deserialize);
+	m_memoryBankController->updateMappedBanks();
 }
 
 void ggb::Cartridge::saveRAM(const std::filesystem::path& outputPath)
@@ -65,6 +79,7 @@ void ggb::Cartridge::saveRAM(const std::filesystem::path& outputPath)
 void ggb::Cartridge::loadRAM(const std::filesystem::path& inputPath)
 {
 	m_memoryBankController->loadRAM(inputPath);
+	m_memoryBankController->updateMappedBanks();
 }
 
 void ggb::Cartridge::saveRTC(const std::filesystem::path& outputPath) const
@@ -75,6 +90,7 @@ void ggb::Cartridge::saveRTC(const std::filesystem::path& outputPath) const
 void ggb::Cartridge::loadRTC(const std::filesystem::path& outputPath)
 {
 	m_memoryBankController->loadRTC(outputPath);
+	m_memoryBankController->updateMappedBanks(); // The RTC register selection is part of the RTC state
 }
 
 bool ggb::Cartridge::supportsColor() const
@@ -66,6 +66,11 @@ void ggb::MemoryBankController::saveRAM(const std::filesystem::path& path)
 	serialize.read_write(m_ram);
 }
 
+int ggb::MemoryBankController::getROMBankNumber() const
+{
+	return 1; // No banking -> the second bank is always mapped
+}
+
 void ggb::MemoryBankController::saveRTC(const std::filesystem::path& outputPath)
 {
 	// Do nothing on purpose
@@ -99,6 +104,35 @@ bool ggb::MemoryBankController::shouldEnableRAM(uint8_t value)
 	return lowerNibble(value) == 0xA;
 }
 
+void ggb::MemoryBankController::updateMappedBanks()
+{
+	// No RAM, ROM bank 0 is fixed and the MBC selects the second one
+	m_mappedBanks = {};
+	m_mappedBanks.fixedROMBank = getROMBank(0);
+	m_mappedBanks.switchableROMBank = getROMBank(getROMBankNumber());
+}
+
+const ggb::MappedBanks& ggb::MemoryBankController::getMappedBanks() const
+{
+	return m_mappedBanks;
+}
+
+const uint8_t* ggb::MemoryBankController::getROMBank(int bank) const
+{
+	const size_t bankStart = static_cast<size_t>(bank) * ROM_BANK_SIZE;
+	if (bankStart + ROM_BANK_SIZE > m_cartridgeData.size())
+		return nullptr;
+	return m_cartridgeData.data() + bankStart;
+}
+
+uint8_t* ggb::MemoryBankController::getRAMBank(int bank)
+{
+	const size_t bankStart = static_cast<size_t>(bank) * RAM_BANK_SIZE;
+	if (bankStart + RAM_BANK_SIZE > m_ram.size())
+		return nullptr;
+	return m_ram.data() + bankStart;
+}
+
 int ggb::convertRawAddressToBankAddress(uint16_t address, int romBankNumber)
 {
 	auto startAddress = romBankNumber * ROM_BANK_SIZE;
@@ -64,6 +64,11 @@ uint8_t ggb::MemoryBankControllerFive::read(uint16_t address) const
 	return m_cartridgeData[address];
 }
 
+int ggb::MemoryBankControllerFive::getROMBankNumber() const
+{
+	return m_romBankNumber;
+}
+
 void ggb::MemoryBankControllerFive::initialize(std::vector<uint8_t>&& cartridgeData)
 {
 	MemoryBankController::initialize(std::move(cartridgeData));
@@ -73,6 +78,15 @@ void ggb::MemoryBankControllerFive::initialize(std::vector<uint8_t>&& cartridgeD
 	// TODO save and load RAM based on some rule
 }
 
+void ggb::MemoryBankControllerFive::updateMappedBanks()
+{
+	MemoryBankController::updateMappedBanks();
+	if (!m_hasRam || !m_ramEnabled)
+		return;
+	m_mappedBanks.writableRAMBank = getRAMBank(m_ramBankNumber);
+	m_mappedBanks.readableRAMBank = m_mappedBanks.writableRAMBank;
+}
+
 void ggb::MemoryBankControllerFive::serialization(Serialization* serialization)
 {
 	MemoryBankController::serialization(serialization);
@@ -71,6 +71,11 @@ uint8_t ggb::MemoryBankControllerOne::read(uint16_t address) const
 	return m_cartridgeData[address];
 }
 
+int ggb::MemoryBankControllerOne::getROMBankNumber() const
+{
+	return m_romBankNumber;
+}
+
 void ggb::MemoryBankControllerOne::initialize(std::vector<uint8_t>&& cartridgeData)
 {
 	MemoryBankController::initialize(std::move(cartridgeData));
@@ -81,6 +86,15 @@ void ggb::MemoryBankControllerOne::initialize(std::vector<uint8_t>&& cartridgeDa
 	// TODO load ram on some rule (if a file exists with the game name or so)
 }
 
+void ggb::MemoryBankControllerOne::updateMappedBanks()
+{
+	MemoryBankController::updateMappedBanks();
+	if (!m_hasRam || !m_ramEnabled)
+		return;
+	m_mappedBanks.writableRAMBank = getRAMBank(m_ramBankNumber);
+	m_mappedBanks.readableRAMBank = m_mappedBanks.writableRAMBank;
+}
+
 void ggb::MemoryBankControllerOne::serialization(Serialization* serialization)
 {
 	MemoryBankController::serialization(serialization);
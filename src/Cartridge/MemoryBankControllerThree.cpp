@@ -223,6 +223,11 @@ uint8_t ggb::MemoryBankControllerThree::read(uint16_t address) const
 	return m_ram[convertRawAddressToRAMBankAddress(address, m_ramBank)];
 }
 
+int ggb::MemoryBankControllerThree::getROMBankNumber() const
+{
+	return m_romBank;
+}
+
 void ggb::MemoryBankControllerThree::initialize(std::vector<uint8_t>&& cartridgeData)
 {
 	MemoryBankController::initialize(std::move(cartridgeData));
@@ -251,6 +256,17 @@ void ggb::MemoryBankControllerThree::loadRTC(const std::filesystem::path& path)
 	m_rtc.serialize(&deserialize);
 }
 
+void ggb::MemoryBankControllerThree::updateMappedBanks()
+{
+	MemoryBankController::updateMappedBanks();
+	if (!m_hasRam || m_rtc.registerSelected())
+		return;
+	// RAM writes don't check if the RAM is enabled
+	m_mappedBanks.writableRAMBank = getRAMBank(m_ramBank);
+	if (m_ramAndTimerEnabled)
+		m_mappedBanks.readableRAMBank = m_mappedBanks.writableRAMBank;
+}
+
 void ggb::MemoryBankControllerThree::setROMBank(uint8_t value)
 {
 	auto bank = (getROMBankCount() - 1) & value;
@@ -3,6 +3,7 @@
 #include "Constants.hpp"
 #include "Utility.hpp"
 
+#include <algorithm>
 #include <thread>
 
 using namespace ggb;
@@ -15,6 +16,7 @@ ggb::Emulator::Emulator()
 	m_timer = std::make_unique<Timer>(m_bus.get());
 	m_audio = std::make_unique<AudioProcessingUnit>(m_bus.get());
 	m_input = std::make_unique<Input>();
+	m_scheduler = std::make_unique<Scheduler>();
 	setEmulationSpeed(1.0);
 
 	reset();
@@ -43,30 +45,42 @@ void ggb::Emulator::step()
 
 	const bool doubleSpeed = m_bus->isGBCDoubleSpeedOn();
 
-	int cycles = m_cpu->step();
+	const int cycles = runUntilNextEvent(doubleSpeed, true);
 	assert((cycles % 2) == 0);
 	int gbcDoubleSpeedAdjustedCycles = cycles;
 	if (doubleSpeed)
 		gbcDoubleSpeedAdjustedCycles = cycles / 2;
-	m_ppu->step(gbcDoubleSpeedAdjustedCycles);
-	m_timer->step(cycles);
-	m_audio->step(gbcDoubleSpeedAdjustedCycles);
 	synchronizeEmulatorMasterClock(gbcDoubleSpeedAdjustedCycles);
 }
 
 void ggb::Emulator::stepAiMode()
 {
-	const bool doubleSpeed = m_bus->isGBCDoubleSpeedOn();
-	const int cycles = m_cpu->step();
-	assert((cycles % 2) == 0);
-	int gbcDoubleSpeedAdjustedCycles = cycles;
-	if (doubleSpeed)
-		gbcDoubleSpeedAdjustedCycles = cycles / 2;
-	m_ppu->step(gbcDoubleSpeedAdjustedCycles);
-	m_timer->step(cycles);
+	const int cycles = runUntilNextEvent(m_bus->isGBCDoubleSpeedOn(), false);
 	updateMaxSpeedup(cycles);
 }
 
+ggb::RunResult ggb::Emulator::runCycles(int cycles)
+{
+	return run<false>(cycles, false);
+}
+
+ggb::RunResult ggb::Emulator::runCyclesAiMode(int cycles)
+{
+	return run<true>(cycles, false);
+}
+
+ggb::RunResult ggb::Emulator::runFrame()
+{
+	const int gbcDoubleSpeedFactor = m_bus->isGBCDoubleSpeedOn() ? 2 : 1;
+	return run<false>(CPU_CYCLES_PER_FRAME * gbcDoubleSpeedFactor, true);
+}
+
+ggb::RunResult ggb::Emulator::runFrameAiMode()
+{
+	const int gbcDoubleSpeedFactor = m_bus->isGBCDoubleSpeedOn() ? 2 : 1;
+	return run<true>(CPU_CYCLES_PER_FRAME * gbcDoubleSpeedFactor, true);
+}
+
 void ggb::Emulator::reset()
 {
 	// Reset emulator class variables
@@ -88,6 +102,7 @@ void ggb::Emulator::reset()
 	m_timer->reset();
 	m_input->reset();
 	m_audio->reset();
+	m_scheduler->reset();
 }
 
 void ggb::Emulator::setTileDataRenderer(std::unique_ptr<ggb::Renderer> renderer)
@@ -96,9 +111,9 @@ void ggb::Emulator::setTileDataRenderer(std::unique_ptr<ggb::Renderer> renderer)
 	m_ppu->setDrawTileData(true);
 }
 
-void ggb::Emulator::setGameRenderer(std::unique_ptr<ggb::Renderer> renderer)
+bool ggb::Emulator::setGameRenderer(std::unique_ptr<ggb::Renderer> renderer)
 {
-	m_ppu->setGameRenderer(std::move(renderer));
+	return m_ppu->setGameRenderer(std::move(renderer));
 }
 
 bool ggb::Emulator::saveEmulatorState(const std::filesystem::path& outputPath)
@@ -108,6 +123,7 @@ bool ggb::Emulator::saveEmulatorState(const std::filesystem::path& outputPath)
 		auto serializeUnique = std::make_unique<ggb::Serialization>(outputPath, true);
 		auto serialize = serializeUnique.get();
 
+		m_scheduler->synchronizeAll(); // The components are only stepped lazily
 		serialization(serialize);
 		m_currentCartridge->serialize(serialize);
 	}
@@ -150,6 +166,7 @@ void ggb::Emulator::saveRAM(const std::filesystem::path& path)
 void ggb::Emulator::loadRAM(const std::filesystem::path& path)
 {
 	m_currentCartridge->loadRAM(path);
+	m_bus->updateCartridgeMemoryPages();
 }
 
 void ggb::Emulator::saveRTC(const std::filesystem::path& path) const
@@ -160,6 +177,7 @@ void ggb::Emulator::saveRTC(const std::filesystem::path& path) const
 void ggb::Emulator::loadRTC(const std::filesystem::path& path)
 {
 	m_currentCartridge->loadRTC(path);
+	m_bus->updateCartridgeMemoryPages();
 }
 
 void ggb::Emulator::setEmulationSpeed(double emulationSpeed)
@@ -241,6 +259,41 @@ void ggb::Emulator::setColorCorrectionEnabled(bool enabled)
 	m_ppu->setColorCorrectionEnabled(enabled);
 }
 
+void ggb::Emulator::setFrameSkip(int renderEveryNthFrame)
+{
+	m_ppu->setFrameSkip(renderEveryNthFrame);
+}
+
+void ggb::Emulator::setFrameOutputEnabled(bool enabled)
+{
+	m_ppu->setFrameOutputEnabled(enabled);
+}
+
+FrameView ggb::Emulator::getCompletedFrame() const
+{
+	return m_ppu->getCompletedFrame();
+}
+
+void ggb::Emulator::setFrameExchange(std::shared_ptr<FrameExchange> exchange)
+{
+	m_ppu->setFrameExchange(std::move(exchange));
+}
+
+bool ggb::Emulator::setPixelFormat(PixelFormat format)
+{
+	return m_ppu->setPixelFormat(format);
+}
+
+void ggb::Emulator::setObservation(std::optional<ObservationSettings> settings)
+{
+	m_ppu->setObservation(std::move(settings));
+}
+
+FrameView ggb::Emulator::getObservation() const
+{
+	return m_ppu->getObservation();
+}
+
 uint8_t ggb::Emulator::readBUS(uint16_t address) const
 {
 	return m_bus->read(address);
@@ -251,6 +304,11 @@ const CPUState* ggb::Emulator::getCPUState() const
 	return m_cpu->getCPUState();
 }
 
+void ggb::Emulator::setIdleLoopSkipping(bool enabled)
+{
+	m_cpu->setIdleLoopDetection(enabled);
+}
+
 void Emulator::setEnergySaving(bool value)
 {
     m_energySaving = value;
@@ -283,8 +341,13 @@ void ggb::Emulator::rewire()
 	m_bus->setPixelProcessingUnit(m_ppu.get());
 	m_bus->setAudio(m_audio.get());
 	m_bus->setInput(m_input.get());
+	m_bus->setScheduler(m_scheduler.get());
+	m_bus->buildIORegisterTable();
+	m_scheduler->setComponents(m_ppu.get(), m_timer.get(), m_audio.get());
 	m_ppu->setBus(m_bus.get());
+	m_ppu->setScheduler(m_scheduler.get());
 	m_cpu->setBus(m_bus.get());
+	m_cpu->setScheduler(m_scheduler.get());
 	m_timer->setBus(m_bus.get());
 	m_audio->setBus(m_bus.get());
 	m_input->setBus(m_bus.get());
@@ -306,6 +369,8 @@ bool ggb::Emulator::loadEmulatorState(Serialization* deserialize)
 		m_currentCartridge->deserialize(deserialize);
 
 		rewire();
+		m_scheduler->reset(); // The components were synchronized when the state was saved
+		m_ppu->resetFrameCount(); // The frame numbers and cycles count from the loaded state on
 	}
 	catch (const std::exception& e)
 	{
@@ -315,6 +380,56 @@ bool ggb::Emulator::loadEmulatorState(Serialization* deserialize)
 	return true;
 }
 
+int ggb::Emulator::runUntilNextEvent(bool doubleSpeed, bool includeAudio, uint64_t endCycle)
+{
+	m_scheduler->setMode(doubleSpeed, includeAudio);
+	const auto startCycle = m_scheduler->getCurrentCycle();
+	do
+	{
+		int cycles = m_cpu->step(endCycle);
+		const int idleLoopCycles = m_cpu->getIdleLoopCycles();
+		if (idleLoopCycles != 0)
+		{
+			// Until the next event every iteration of the idle loop (or halted machine cycle) is the same,
+			// skip all iterations that end before it
+			const auto deadline = std::min(m_scheduler->getNextDeadline(), endCycle);
+			const auto untilNextEvent = static_cast<int64_t>(deadline - m_scheduler->getCurrentCycle()) - cycles;
+			if (untilNextEvent > idleLoopCycles)
+				cycles += static_cast<int>((untilNextEvent - 1) / idleLoopCycles) * idleLoopCycles;
+		}
+		m_scheduler->advance(cycles);
+	} while (m_scheduler->getCurrentCycle() < std::min(m_scheduler->getNextDeadline(), endCycle));
+
+	m_scheduler->synchronizeDueComponents();
+	return static_cast<int>(m_scheduler->getCurrentCycle() - startCycle);
+}
+
+template <bool AiMode>
+ggb::RunResult ggb::Emulator::run(int cycles, bool untilFrameCompleted)
+{
+	RunResult result = {};
+	if (!AiMode && m_paused)
+		return result;
+
+	const auto frameCount = m_ppu->getFrameCount();
+	const auto endCycle = m_scheduler->getCurrentCycle() + cycles;
+	while (m_scheduler->getCurrentCycle() < endCycle)
+	{
+		const bool doubleSpeed = m_bus->isGBCDoubleSpeedOn();
+		const int elapsedCycles = runUntilNextEvent(doubleSpeed, !AiMode, endCycle);
+		if constexpr (AiMode)
+			updateMaxSpeedup(elapsedCycles);
+		else
+			synchronizeEmulatorMasterClock(doubleSpeed ? elapsedCycles / 2 : elapsedCycles);
+
+		result.cycles += elapsedCycles;
+		result.frameCompleted = m_ppu->getFrameCount() != frameCount;
+		if (untilFrameCompleted && result.frameCompleted)
+			break;
+	}
+	return result;
+}
+
 void ggb::Emulator::updateMaxSpeedup(int elapsedCycles)
 {
 	static constexpr long long nanoSecondsPerSecond = 1000000000;
@@ -20,7 +20,9 @@ void ggb::GBCColorRAM::setBus(BUS* bus)
 
 void ggb::GBCColorRAM::write(uint8_t value)
 {
-	m_colorRAM[getRAMAddress()] = value;
+	const auto ramAddress = getRAMAddress();
+	m_colorRAM[ramAddress] = value;
+	updateColor(ramAddress / 2); // Every color consists of two bytes
 	if (isBitSet<7>(*m_paletteSpecification))
 		incrementAddress();
 }
@@ -34,6 +36,7 @@ void ggb::GBCColorRAM::serialization(Serialization* serialization)
 {
 	serialization->read_write(m_colorRAM);
 	serialization->read_write(m_colorPalettes);
+	updateColorPalettes(); // m_colorPalettes depend on the color correction setting, which is not serialized with them
 }
 
 const ggb::ColorPalette& ggb::GBCColorRAM::getColorPalette(size_t index) const
@@ -41,29 +44,10 @@ const ggb::ColorPalette& ggb::GBCColorRAM::getColorPalette(size_t index) const
 	return m_colorPalettes[index];
 }
 
-static uint8_t  convertGameboyColorRGBTo24BitRGB(uint16_t number) 
+void ggb::GBCColorRAM::setColorCorrectionEnabled(bool enabled)
 {
-	static constexpr auto gbcSingleColorValueRange = 31; // 5 bits -> 2^5 = 32
-	static constexpr auto normalRGBSingleColorValueRange = 255; // 8 bits -> 2 ^8 = 256
-	return number * normalRGBSingleColorValueRange / gbcSingleColorValueRange;
-}
-
-void ggb::GBCColorRAM::updateColorPalettes()
-{
-	static constexpr uint16_t colorBitMask = 0b11111;
-	size_t ramIndex = 0;
-
-	for (auto& palette : m_colorPalettes) 
-	{
-		for (auto& color : palette.m_color) 
-		{
-			const uint16_t combined = (static_cast<uint16_t>(m_colorRAM[ramIndex + 1]) << 8) | m_colorRAM[ramIndex];
-			color.r = convertGameboyColorRGBTo24BitRGB(combined & colorBitMask);
-			color.g = convertGameboyColorRGBTo24BitRGB((combined >> 5) & colorBitMask);
-			color.b = convertGameboyColorRGBTo24BitRGB((combined >> 10) & colorBitMask);
-			ramIndex += 2;
-		}
-	}
+	m_colorCorrectionEnabled = enabled;
+	updateColorPalettes();
 }
 
 size_t ggb::GBCColorRAM::getRAMAddress() const
@@ -78,3 +62,16 @@ void ggb::GBCColorRAM::incrementAddress()
 	*m_paletteSpecification = *m_paletteSpecification & ~0b111111;
 	*m_paletteSpecification |= address;
 }
+
+void ggb::GBCColorRAM::updateColor(size_t colorIndex)
+{
+	const size_t ramIndex = colorIndex * 2;
+	const uint16_t combined = (static_cast<uint16_t>(m_colorRAM[ramIndex + 1]) << 8) | m_colorRAM[ramIndex];
+	m_colorPalettes[colorIndex / 4].m_color[colorIndex % 4] = convertGBCColorToRGB(combined, m_colorCorrectionEnabled);
+}
+
+void ggb::GBCColorRAM::updateColorPalettes()
+{
+	for (size_t colorIndex = 0; colorIndex < GBC_COLOR_RAM_MEMORY_SIZE / 2; ++colorIndex)
+		updateColor(colorIndex);
+}
@@ -0,0 +1,103 @@
+#include "IdleLoopDetector.hpp"
+
+#include "CPUInstructions.hpp"
+#include "Constants.hpp"
+#include "Utility.hpp"
+
+int ggb::IdleLoopDetector::getIterationCycles(const CPUState& cpuState, BUS* bus, uint16_t jumpAddress)
+{
+	CPUState loopState = cpuState;
+	const uint16_t loopStart = loopState.getInstructionPointer();
+	if (loopStart > jumpAddress || (jumpAddress - loopStart) >= MAX_LOOP_LENGTH)
+		return 0;
+	if (!isJumpTo(bus, jumpAddress, loopStart))
+		return 0;
+
+	int instructionCount = 1; // The jump
+	uint16_t address = loopStart;
+	while (address < jumpAddress)
+	{
+		const int length = getLoopBodyInstructionLength(&loopState, bus, address);
+		if (length == 0)
+			return 0;
+		address += length;
+		++instructionCount;
+	}
+	if (address != jumpAddress)
+		return 0;
+
+	// Run one iteration on a copy of the state, the loop body only reads memory which has no side effects
+	int cycles = 0;
+	for (int i = 0; i < instructionCount; ++i)
+	{
+		const uint8_t opCode = bus->read(loopState.InstructionPointer()++);
+		cycles += OPCodes::execute(opCode, &loopState, bus);
+	}
+
+	// The loop body can only change A and the flags, if they are the same the next iteration is an exact repetition
+	CPUState currentState = cpuState;
+	if (loopState.getInstructionPointer() != loopStart || loopState.AF() != currentState.AF())
+		return 0;
+	return cycles;
+}
+
+int ggb::IdleLoopDetector::getLoopBodyInstructionLength(CPUState* cpuState, const BUS* bus, uint16_t address)
+{
+	switch (bus->read(address))
+	{
+	case 0xF0: // LDH A,(FF00+u8)
+		return isPolledAddress(0xFF00 + bus->read(address + 1)) ? 2 : 0;
+	case 0xF2: // LD A,(FF00+C)
+		return isPolledAddress(0xFF00 + cpuState->C()) ? 1 : 0;
+	case 0xFA: // LD A,(u16)
+		return isPolledAddress(combineUpperAndLower(bus->read(address + 2), bus->read(address + 1))) ? 3 : 0;
+	case 0x0A: // LD A,(BC)
+		return isPolledAddress(cpuState->BC()) ? 1 : 0;
+	case 0x1A: // LD A,(DE)
+		return isPolledAddress(cpuState->DE()) ? 1 : 0;
+	case 0x7E: // LD A,(HL)
+		return isPolledAddress(cpuState->HL()) ? 1 : 0;
+	case 0xFE: // CP A,u8
+	case 0xE6: // AND A,u8
+	case 0xF6: // OR A,u8
+		return 2;
+	case 0xA7: // AND A,A
+	case 0xB7: // OR A,A
+		return 1;
+	case 0xCB: // BIT b,A
+		return (bus->read(address + 1) & 0xC7) == 0x47 ? 2 : 0;
+	default:
+		return 0;
+	}
+}
+
+bool ggb::IdleLoopDetector::isJumpTo(const BUS* bus, uint16_t jumpAddress, uint16_t loopStart)
+{
+	switch (bus->read(jumpAddress))
+	{
+	case 0x18: // JR i8
+	case 0x20: // JR NZ,i8
+	case 0x28: // JR Z,i8
+	case 0x30: // JR NC,i8
+	case 0x38: // JR C,i8
+		return static_cast<uint16_t>(jumpAddress + 2 + bus->readSigned(jumpAddress + 1)) == loopStart;
+	case 0xC3: // JP u16
+	case 0xC2: // JP NZ,u16
+	case 0xCA: // JP Z,u16
+	case 0xD2: // JP NC,u16
+	case 0xDA: // JP C,u16
+		return combineUpperAndLower(bus->read(jumpAddress + 2), bus->read(jumpAddress + 1)) == loopStart;
+	default:
+		return false;
+	}
+}
+
+bool ggb::IdleLoopDetector::isPolledAddress(uint16_t address)
+{
+	// Memory that only changes on PPU / Timer events or interrupts while the cpu is spinning
+	// (DIV, TIMA and the input register change in between and are therefore not allowed)
+	return address == INTERRUPT_REQUEST_ADDRESS
+		|| (address >= LCD_CONTROL_REGISTER_ADDRESS && address <= LCD_WINDOW_X_ADDRESS)
+		|| isHRAMAddress(address)
+		|| isWRAMAddress(address);
+}
@@ -0,0 +1,92 @@
+#include "ObservationBuffer.hpp"
+
+#include <algorithm>
+
+ggb::ObservationBuffer::ObservationBuffer(const ObservationSettings& settings)
+	: m_settings(settings)
+{
+	assert(settings.format == PixelFormat::GRAYSCALE8 || settings.format == PixelFormat::PALETTE_INDEX);
+	if (m_settings.format != PixelFormat::PALETTE_INDEX)
+		m_settings.format = PixelFormat::GRAYSCALE8;
+	m_settings.width = std::clamp(settings.width, 1, static_cast<int>(GAME_WINDOW_WIDTH));
+	m_settings.height = std::clamp(settings.height, 1, static_cast<int>(GAME_WINDOW_HEIGHT));
+
+	const auto mapToObservation = [](int size, int observationSize, std::vector<int>* targets, std::vector<int>* counts, std::vector<int>* samples)
+	{
+		counts->resize(observationSize, 0);
+		for (int i = 0; i < size; ++i)
+		{
+			targets->push_back(i * observationSize / size);
+			++(*counts)[targets->back()];
+		}
+		for (int i = 0; i < observationSize; ++i)
+			samples->push_back(((2 * i + 1) * size) / (2 * observationSize));
+	};
+	mapToObservation(GAME_WINDOW_WIDTH, m_settings.width, &m_targetColumns, &m_columnPixelCounts, &m_sampleColumns);
+	mapToObservation(GAME_WINDOW_HEIGHT, m_settings.height, &m_targetRows, &m_rowPixelCounts, &m_sampleRows);
+
+	const size_t size = static_cast<size_t>(m_settings.width) * m_settings.height;
+	m_rowSums.resize(m_settings.width, 0);
+	m_currentFrame.resize(size, 0);
+	m_previousFrame.resize(size, 0);
+	m_observation.resize(size, 0);
+}
+
+const ggb::ObservationSettings& ggb::ObservationBuffer::getSettings() const
+{
+	return m_settings;
+}
+
+void ggb::ObservationBuffer::writeLine(int y, const uint8_t* line)
+{
+	const int row = m_targetRows[y];
+	uint8_t* observationRow = m_currentFrame.data() + (row * m_settings.width);
+
+	if (m_settings.format == PixelFormat::PALETTE_INDEX)
+	{
+		if (y != m_sampleRows[row])
+			return;
+		for (int column = 0; column < m_settings.width; ++column)
+			observationRow[column] = line[m_sampleColumns[column]];
+		return;
+	}
+
+	if (isFirstLineOfRow(y))
+		std::fill(m_rowSums.begin(), m_rowSums.end(), 0);
+	for (int x = 0; x < GAME_WINDOW_WIDTH; ++x)
+		m_rowSums[m_targetColumns[x]] += line[x];
+	if (!isLastLineOfRow(y))
+		return;
+
+	for (int column = 0; column < m_settings.width; ++column)
+		observationRow[column] = static_cast<uint8_t>(m_rowSums[column] / (m_columnPixelCounts[column] * m_rowPixelCounts[row]));
+}
+
+void ggb::ObservationBuffer::completeFrame()
+{
+	if (!m_settings.maxPoolLastTwoFrames)
+	{
+		m_observation = m_currentFrame;
+		return;
+	}
+
+	for (size_t i = 0; i < m_observation.size(); ++i)
+		m_observation[i] = std::max(m_currentFrame[i], m_previousFrame[i]);
+	m_previousFrame = m_currentFrame;
+}
+
+ggb::FrameView ggb::ObservationBuffer::getView(uint64_t frameNumber, uint64_t cycle) const
+{
+	return FrameView{ m_observation.data(), m_settings.format, static_cast<size_t>(m_settings.width),
+		static_cast<size_t>(m_settings.height), frameNumber, cycle };
+}
+
+bool ggb::ObservationBuffer::isFirstLineOfRow(int y) const
+{
+	return y == 0 || m_targetRows[y - 1] != m_targetRows[y];
+}
+
+bool ggb::ObservationBuffer::isLastLineOfRow(int y) const
+{
+	return y == GAME_WINDOW_HEIGHT - 1 || m_targetRows[y + 1] != m_targetRows[y];
+}
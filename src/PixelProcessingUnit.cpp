@@ -5,12 +5,11 @@
 #include "Utility.hpp"
 #include "Logging.hpp"
 #include "Constants.hpp"
+#include "Scheduler.hpp"
 
 
 using namespace ggb;
 
-static constexpr int VRAM_TILE_COUNT = 384;
-
 ggb::PixelProcessingUnit::PixelProcessingUnit(BUS* bus)
 {
 	setBus(bus);
@@ -27,10 +26,21 @@ void ggb::PixelProcessingUnit::reset()
 	m_backgroundAndWindowPixelBuffer = std::vector<BackgroundAndWindowPixel>(GAME_WINDOW_WIDTH, { {} });
 	m_gameFrameBuffer = std::make_unique<FrameBuffer>(GAME_WINDOW_WIDTH, GAME_WINDOW_HEIGHT);
 	m_tileDataFrameBuffer = std::make_unique<FrameBuffer>(TILE_DATA_WIDTH, TILE_DATA_HEIGHT);
+	setPixelFormat(m_pixelFormat); // Clears the frame
+	if (m_observation)
+		setObservation(m_observation->getSettings());
 	m_vramTiles = std::vector<Tile>(VRAM_TILE_COUNT, ggb::Tile{});
+	m_tileCache.invalidateAll();
+	resetFrameCount();
 
 	updateLCDMode();
 	updateEnabled();
+	updateDMGPalettes();
+}
+
+void ggb::PixelProcessingUnit::setScheduler(const Scheduler* scheduler)
+{
+	m_scheduler = scheduler;
 }
 
 void ggb::PixelProcessingUnit::setBus(BUS* bus)
@@ -51,6 +61,7 @@ void ggb::PixelProcessingUnit::setBus(BUS* bus)
 	m_GBCObjectColorRAM.setBus(m_bus);
 	m_VRAMBank0Ptr = m_bus->getVRAMStartPointer(0);
 	m_VRAMBank1Ptr = m_bus->getVRAMStartPointer(1);
+	m_tileCache.setVRAM(m_VRAMBank0Ptr, m_VRAMBank1Ptr);
 	m_GBCObjectPriorityMode = m_bus->getPointerIntoMemory(GBC_OBJECT_PRIORITY_MODE_ADDRESS);
 
 	m_objects.resize(OBJECT_COUNT);
@@ -99,7 +110,8 @@ void ggb::PixelProcessingUnit::step(int elapsedCycles)
 	{
 		setLCDMode(LCDMode::HBLank);
 		handleModeTransitionInterrupt(LCDInterrupt::HBlank);
-		writeCurrentScanLineIntoFrameBuffer();
+		if (m_writeCurrentScanLine && isFrameRendered(m_frameCount))
+			(this->*m_writeCurrentScanLine)();
 		m_bus->handleHBlank();
 		return;
 	}
@@ -109,10 +121,12 @@ void ggb::PixelProcessingUnit::step(int elapsedCycles)
 		if (line >= 144)
 		{
 			setLCDMode(LCDMode::VBLank);
+			++m_frameCount;
 			m_bus->requestInterrupt(INTERRUPT_VBLANK_BIT);
 			handleModeTransitionInterrupt(LCDInterrupt::VBlank);
 			updateAndRenderTileData();
-			renderGame();
+			if (m_writeCurrentScanLine && isFrameRendered(m_frameCount - 1))
+				completeFrame();
 		}
 		else
 		{
@@ -136,6 +150,97 @@ void ggb::PixelProcessingUnit::step(int elapsedCycles)
 	}
 }
 
+uint64_t ggb::PixelProcessingUnit::getFrameCount() const
+{
+	return m_frameCount;
+}
+
+void ggb::PixelProcessingUnit::resetFrameCount()
+{
+	m_frameCount = 0;
+	m_completedFrameNumber = 0;
+	m_completedFrameCycle = 0;
+}
+
+void ggb::PixelProcessingUnit::setFrameSkip(int renderEveryNthFrame)
+{
+	m_renderEveryNthFrame = std::max(renderEveryNthFrame, 1);
+}
+
+void ggb::PixelProcessingUnit::setFrameOutputEnabled(bool enabled)
+{
+	m_frameOutputEnabled = enabled;
+	updateScanlineRendering();
+}
+
+FrameView ggb::PixelProcessingUnit::getCompletedFrame() const
+{
+	const uint8_t* pixels = m_formattedFrame.data();
+	if (m_pixelFormat == PixelFormat::RGB)
+		pixels = reinterpret_cast<const uint8_t*>(m_gameFrameBuffer->getRawData().data());
+	return FrameView{ pixels, m_pixelFormat, GAME_WINDOW_WIDTH, GAME_WINDOW_HEIGHT, m_completedFrameNumber, m_completedFrameCycle };
+}
+
+bool ggb::PixelProcessingUnit::setPixelFormat(PixelFormat format)
+{
+	if (m_gameRenderer && format != PixelFormat::RGB)
+	{
+		logError("The pixel format has to be RGB while a game renderer is set");
+		return false;
+	}
+
+	m_pixelFormat = format;
+	if (format == PixelFormat::RGB)
+		m_formattedFrame = {};
+	else
+		m_formattedFrame = std::vector<uint8_t>(GAME_WINDOW_WIDTH * GAME_WINDOW_HEIGHT * getBytesPerPixel(format), 0);
+
+	// Black like the RGB frame buffer until the lines are rendered, but opaque
+	if (format == PixelFormat::RGBA8888 || format == PixelFormat::BGRA8888)
+	{
+		for (size_t i = 3; i < m_formattedFrame.size(); i += 4)
+			m_formattedFrame[i] = 0xFF;
+	}
+	updateScanlineRendering();
+	return true;
+}
+
+void ggb::PixelProcessingUnit::setFrameExchange(std::shared_ptr<FrameExchange> exchange)
+{
+	m_frameExchange = std::move(exchange);
+	updateScanlineRendering();
+}
+
+void ggb::PixelProcessingUnit::setObservation(std::optional<ObservationSettings> settings)
+{
+	m_observation = settings ? std::make_unique<ObservationBuffer>(*settings) : nullptr;
+	updateScanlineRendering();
+}
+
+FrameView ggb::PixelProcessingUnit::getObservation() const
+{
+	if (!m_observation)
+		return FrameView{};
+	return m_observation->getView(m_completedFrameNumber, m_completedFrameCycle);
+}
+
+void ggb::PixelProcessingUnit::invalidateTileData(size_t bank, uint16_t vramIndex, uint16_t sizeInBytes)
+{
+	m_tileCache.invalidate(bank, vramIndex, sizeInBytes);
+}
+
+bool ggb::PixelProcessingUnit::isFrameRendered(uint64_t frame) const
+{
+	return (frame % m_renderEveryNthFrame) == 0;
+}
+
+int ggb::PixelProcessingUnit::cyclesUntilNextEvent() const
+{
+	if (!m_enabled)
+		return m_currentMode == LCDMode::HBLank ? NO_PENDING_EVENT : 0;
+	return m_currentModeDuration - m_cycleCounter;
+}
+
 void ggb::PixelProcessingUnit::setLCDMode(LCDMode mode)
 {
 	setBitToValue<0>(*m_LCDStatus, static_cast<uint8_t>(mode) & 1);
@@ -148,14 +253,23 @@ void ggb::PixelProcessingUnit::setTileDataRenderer(std::unique_ptr<Renderer> ren
 	m_tileDataRenderer = std::move(renderer);
 }
 
-void ggb::PixelProcessingUnit::setGameRenderer(std::unique_ptr<Renderer> renderer)
+bool ggb::PixelProcessingUnit::setGameRenderer(std::unique_ptr<Renderer> renderer)
 {
+	if (renderer && m_pixelFormat != PixelFormat::RGB)
+	{
+		logError("A game renderer can only be set while the pixel format is RGB");
+		return false;
+	}
+
 	m_gameRenderer = std::move(renderer);
+	updateScanlineRendering();
+	return true;
 }
 
 void ggb::PixelProcessingUnit::setGBCMode(bool value)
 {
 	m_GBCMode = value;
+	updateScanlineRendering();
 }
 
 Dimensions ggb::PixelProcessingUnit::getTileDataDimensions() const
@@ -184,13 +298,15 @@ void ggb::PixelProcessingUnit::serialization(Serialization* serialization)
 	serialization->read_write(m_objColorBuffer);
 	serialization->read_write(m_backgroundAndWindowPixelBuffer);
 	serialization->read_write(m_currentObjectRowPixelBuffer);
-	// No need to serialize m_backgroundPaletteValue, as it should always get set before using it
-	//serialization->read_write(m_backgroundPaletteValue); 
+	// No need to serialize the DMG palettes, they are converted again from the loaded registers
 
 	m_GBCBackgroundColorRAM.serialization(serialization);
 	m_GBCObjectColorRAM.serialization(serialization);
 	m_gameFrameBuffer->serialization(serialization);
 	m_tileDataFrameBuffer->serialization(serialization);
+	m_tileCache.invalidateAll(); // The VRAM was loaded by the BUS
+	setColorCorrectionEnabled(m_colorCorrectionEnabled); // Also converts the palettes again
+	updateScanlineRendering();
 }
 
 void ggb::PixelProcessingUnit::GBCWriteToColorRAM(uint16_t address, uint8_t value)
@@ -215,7 +331,11 @@ uint8_t ggb::PixelProcessingUnit::GBCReadColorRAM(uint16_t address) const
 
 void ggb::PixelProcessingUnit::setColorCorrectionEnabled(bool enabled)
 {
+	// The palettes already contain the corrected colors, so the frame doesn't have to be corrected
 	m_colorCorrectionEnabled = enabled;
+	m_GBCBackgroundColorRAM.setColorCorrectionEnabled(enabled);
+	m_GBCObjectColorRAM.setColorCorrectionEnabled(enabled);
+	updateDMGPalettes();
 }
 
 void ggb::PixelProcessingUnit::updateLCDMode()
@@ -230,58 +350,140 @@ void ggb::PixelProcessingUnit::updateEnabled()
 	m_enabled = isBitSet<7>(*m_LCDControl);
 }
 
-void ggb::PixelProcessingUnit::renderGame()
+static ColorPalette getPalette(uint8_t value, bool colorCorrected)
 {
-	if (!m_gameRenderer)
-		return;
+	ColorPalette result = {};
+	result.m_color[0] = convertGBColorToRGB(static_cast<GBColor>(value & 0b11), colorCorrected);
+	result.m_color[1] = convertGBColorToRGB(static_cast<GBColor>((value >> 2) & 0b11), colorCorrected);
+	result.m_color[2] = convertGBColorToRGB(static_cast<GBColor>((value >> 4) & 0b11), colorCorrected);
+	result.m_color[3] = convertGBColorToRGB(static_cast<GBColor>((value >> 6) & 0b11), colorCorrected);
+	return result;
+}
+
+void ggb::PixelProcessingUnit::updateDMGPalettes()
+{
+	m_backgroundPaletteValue = getPalette(*m_backgroundPalette, m_colorCorrectionEnabled);
+	m_objectPalette0Value = getPalette(*m_objectPalette0, m_colorCorrectionEnabled);
+	m_objectPalette1Value = getPalette(*m_objectPalette1, m_colorCorrectionEnabled);
+}
 
-	if (m_colorCorrectionEnabled) 
+void ggb::PixelProcessingUnit::updateScanlineRendering()
+{
+	if (!m_gameRenderer && !m_frameOutputEnabled && !m_frameExchange && !m_observation)
+		m_writeCurrentScanLine = nullptr;
+	else if (m_GBCMode)
+		m_writeCurrentScanLine = getScanlineRendering<true>();
+	else
+		m_writeCurrentScanLine = getScanlineRendering<false>();
+}
+
+template <bool GBCMode>
+ggb::PixelProcessingUnit::ScanlineRendering ggb::PixelProcessingUnit::getScanlineRendering() const
+{
+	switch (m_pixelFormat)
 	{
-		auto& rawData = m_gameFrameBuffer->getRawData();
-		for (auto& value : rawData)
-			value = colorCorrection(value);
+	case PixelFormat::RGBA8888:			return &PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer<GBCMode, PixelFormat::RGBA8888>;
+	case PixelFormat::BGRA8888:			return &PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer<GBCMode, PixelFormat::BGRA8888>;
+	case PixelFormat::RGB565:			return &PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer<GBCMode, PixelFormat::RGB565>;
+	case PixelFormat::PALETTE_INDEX:	return &PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer<GBCMode, PixelFormat::PALETTE_INDEX>;
+	case PixelFormat::GRAYSCALE8:		return &PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer<GBCMode, PixelFormat::GRAYSCALE8>;
+	default:							return &PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer<GBCMode, PixelFormat::RGB>;
 	}
+}
 
-	m_gameRenderer->renderNewFrame(*m_gameFrameBuffer);
+void ggb::PixelProcessingUnit::completeFrame()
+{
+	m_completedFrameNumber = m_frameCount;
+	m_completedFrameCycle = m_scheduler ? m_scheduler->getCurrentCycle() : 0;
+	if (m_frameExchange)
+	{
+		const auto view = getCompletedFrame();
+		auto& frame = m_frameExchange->getWriteBuffer();
+		// Only allocates if the buffer is used for the first time or the pixel format changed
+		frame.pixels.assign(view.pixels, view.pixels + (view.width * view.height * getBytesPerPixel(view.format)));
+		frame.format = view.format;
+		frame.width = view.width;
+		frame.height = view.height;
+		frame.frameNumber = view.frameNumber;
+		frame.cycle = view.cycle;
+		m_frameExchange->publish();
+	}
+	if (m_observation)
+		m_observation->completeFrame();
+	if (m_gameRenderer)
+		m_gameRenderer->renderNewFrame(*m_gameFrameBuffer);
 }
 
-static ColorPalette getPalette(uint8_t value)
+static uint8_t getGrayscale(const RGB& rgb)
 {
-	ColorPalette result = {};
-	result.m_color[0] = convertGBColorToRGB(static_cast<GBColor>(value & 0b11));
-	result.m_color[1] = convertGBColorToRGB(static_cast<GBColor>((value >> 2) & 0b11));
-	result.m_color[2] = convertGBColorToRGB(static_cast<GBColor>((value >> 4) & 0b11));
-	result.m_color[3] = convertGBColorToRGB(static_cast<GBColor>((value >> 6) & 0b11));
-	return result;
+	return static_cast<uint8_t>(((rgb.r * 77) + (rgb.g * 150) + (rgb.b * 29)) >> 8); // BT.601 luma
 }
 
-void ggb::PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer()
+template <PixelFormat Format>
+static void writePixel(uint8_t* row, int x, const RGB& rgb, uint8_t colorValue)
 {
-	m_backgroundPaletteValue = getPalette(*m_backgroundPalette);
-	if (m_GBCMode) 
+	if constexpr (Format == PixelFormat::RGB)
+	{
+		reinterpret_cast<RGB*>(row)[x] = rgb;
+	}
+	else if constexpr (Format == PixelFormat::RGBA8888)
+	{
+		uint8_t* pixel = row + (x * 4);
+		pixel[0] = rgb.r;
+		pixel[1] = rgb.g;
+		pixel[2] = rgb.b;
+		pixel[3] = 0xFF;
+	}
+	else if constexpr (Format == PixelFormat::BGRA8888)
+	{
+		uint8_t* pixel = row + (x * 4);
+		pixel[0] = rgb.b;
+		pixel[1] = rgb.g;
+		pixel[2] = rgb.r;
+		pixel[3] = 0xFF;
+	}
+	else if constexpr (Format == PixelFormat::RGB565)
+	{
+		reinterpret_cast<uint16_t*>(row)[x] = static_cast<uint16_t>(((rgb.r >> 3) << 11) | ((rgb.g >> 2) << 5) | (rgb.b >> 3));
+	}
+	else if constexpr (Format == PixelFormat::PALETTE_INDEX)
+	{
+		row[x] = colorValue;
+	}
+	else
 	{
-		m_GBCBackgroundColorRAM.updateColorPalettes();
-		m_GBCObjectColorRAM.updateColorPalettes();
+		static_assert(Format == PixelFormat::GRAYSCALE8);
+		row[x] = getGrayscale(rgb);
 	}
+}
 
-	if (m_GBCMode || isBitSet<0>(*m_LCDControl)) 
+template <bool GBCMode, PixelFormat Format>
+void ggb::PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer()
+{
+	if (GBCMode || isBitSet<0>(*m_LCDControl)) 
 	{
 		// Not quite correct, instead of turning the background and window off, it should be white
-		writeCurrentBackgroundLineIntoFrameBuffer();
+		writeCurrentBackgroundLineIntoFrameBuffer<GBCMode>();
 		if (isBitSet<5>(*m_LCDControl))
-			writeCurrentWindowLineIntoBuffer();
+			writeCurrentWindowLineIntoBuffer<GBCMode>();
 	}
 	
 	const bool fillObjectBuffer = isBitSet<1>(*m_LCDControl);
 	if (fillObjectBuffer) 
 	{
-		updateCurrentScanlineObjects();
-		writeCurrentObjectLineIntoBuffer();
+		updateCurrentScanlineObjects<GBCMode>();
+		writeCurrentObjectLineIntoBuffer<GBCMode>();
 	}
 
 	const auto currentScanline = scanLine();
-	auto frameBufferRow = m_gameFrameBuffer->getRow(currentScanline);
-	const bool objectAlwaysOnTop = m_GBCMode && !isBitSet<0>(*m_LCDControl);
+	uint8_t* frameBufferRow = nullptr;
+	if constexpr (Format == PixelFormat::RGB)
+		frameBufferRow = reinterpret_cast<uint8_t*>(m_gameFrameBuffer->getRow(currentScanline));
+	else
+		frameBufferRow = m_formattedFrame.data() + (currentScanline * GAME_WINDOW_WIDTH * getBytesPerPixel(Format));
+	const bool objectAlwaysOnTop = GBCMode && !isBitSet<0>(*m_LCDControl);
+	const bool observeColorValues = m_observation && m_observation->getSettings().format == PixelFormat::PALETTE_INDEX;
+	const bool observeGrayscale = m_observation && !observeColorValues;
 
 	for (int x = 0; x < GAME_WINDOW_WIDTH; x++)
 	{
@@ -289,16 +491,23 @@ void ggb::PixelProcessingUnit::writeCurrentScanLineIntoFrameBuffer()
 		const auto& objectPixel = m_currentObjectRowPixelBuffer[x];
 
 		const bool objectSettingBackgroundOverObject = objectPixel.backgroundOverObj && (backgroundAndWindowPixel.rawColorValue != 0);
-		const bool backgroundSettingBackgroundOverObject = m_GBCMode && backgroundAndWindowPixel.backgroundOverObj && (backgroundAndWindowPixel.rawColorValue != 0);
+		const bool backgroundSettingBackgroundOverObject = GBCMode && backgroundAndWindowPixel.backgroundOverObj && (backgroundAndWindowPixel.rawColorValue != 0);
 		const bool drawObject = fillObjectBuffer && objectPixel.pixelSet && (objectAlwaysOnTop || (!objectSettingBackgroundOverObject && !backgroundSettingBackgroundOverObject));
 
-		if (drawObject)
-			frameBufferRow[x] = objectPixel.rgb;
-		else
-			frameBufferRow[x] = backgroundAndWindowPixel.rgb;
+		const auto& rgb = drawObject ? objectPixel.rgb : backgroundAndWindowPixel.rgb;
+		const auto colorValue = drawObject ? m_currentObjectRowColorValues[x] : backgroundAndWindowPixel.rawColorValue;
+		writePixel<Format>(frameBufferRow, x, rgb, colorValue);
+		if (observeColorValues)
+			m_observationLine[x] = colorValue;
+		else if (observeGrayscale)
+			m_observationLine[x] = getGrayscale(rgb);
 	}
+
+	if (m_observation)
+		m_observation->writeLine(currentScanline, m_observationLine.data());
 }
 
+template <bool GBCMode>
 void ggb::PixelProcessingUnit::updateCurrentScanlineObjects()
 {
 	// Offset needed to convert object coordinates to screen coordinates
@@ -319,7 +528,7 @@ void ggb::PixelProcessingUnit::updateCurrentScanlineObjects()
 			break;
 	}
 
-	if (!m_GBCMode || isBitSet<0>(*m_GBCObjectPriorityMode)) 
+	if (!GBCMode || isBitSet<0>(*m_GBCObjectPriorityMode)) 
 	{
 		// Order objects by x-coordinate
 		// If obj1.x == obj2.x the obj which is first in memory should overlap the one coming after it -> therefore use stable_sort
@@ -337,6 +546,7 @@ void ggb::PixelProcessingUnit::updateCurrentScanlineObjects()
 	std::reverse(m_currentScanlineObjects.begin(), m_currentScanlineObjects.end());
 }
 
+template <bool GBCMode>
 void ggb::PixelProcessingUnit::writeCurrentBackgroundLineIntoFrameBuffer()
 {
 	RenderingScanlineData data = {};
@@ -358,29 +568,28 @@ void ggb::PixelProcessingUnit::writeCurrentBackgroundLineIntoFrameBuffer()
 		assert(tileMapIndex < TILE_MAP_SIZE);
 		data.tileIndexAddress = backgroundTileMap + tileMapIndex;
 
-		writeTileIntoBuffer(&data);
+		writeTileIntoBuffer<GBCMode>(&data);
 	}
 }
 
 
+template <bool GBCMode>
 void ggb::PixelProcessingUnit::writeTileIntoBuffer(RenderingScanlineData* inOutData)
 {
 	auto& screenXPos = inOutData->screenXPos;
 	auto& tileColumn = inOutData->tileColumn;
 	const auto GBCTileData = getBackgroundTileAttributes(inOutData->tileIndexAddress);
 	const auto colorPaletteIndex = GBCTileData & 0b111;
-	const auto& GBCPalette = GBCGetBackgroundAndWindowColorPalette(colorPaletteIndex);
+	const auto& GBCPalette = GBCGetBackgroundAndWindowColorPalette<GBCMode>(colorPaletteIndex);
 	const auto tileAddress = getTileAddress(inOutData->tileIndexAddress, inOutData->signedAddressingMode);
-	uint8_t* vramBank = getVRAMBankPointer(GBCTileData);
+	const auto vramBank = getVRAMBank<GBCMode>(GBCTileData);
 	int tileRow = inOutData->tileRow;
-	const bool tileOverObject = m_GBCMode && isBitSet<7>(GBCTileData);
+	const bool tileOverObject = GBCMode && isBitSet<7>(GBCTileData);
 
 	if (isBitSet<6>(GBCTileData))
 		tileRow = (TILE_HEIGHT - 1) - tileRow; // Flip Y
 
-	getTileRowData(vramBank, tileAddress, tileRow, m_objColorBuffer);
-	if (isBitSet<5>(GBCTileData))
-		std::reverse(m_objColorBuffer.begin(), m_objColorBuffer.end()); // Flip X
+	const auto& colorValues = m_tileCache.getTileRow(vramBank, tileAddress, tileRow, isBitSet<5>(GBCTileData)); // Bit 5 = flip X
 
 	if (screenXPos < 0) 
 	{
@@ -393,7 +602,7 @@ void ggb::PixelProcessingUnit::writeTileIntoBuffer(RenderingScanlineData* inOutD
 
 	for (int i = 0; i < pixelToSet; ++i)
 	{
-		const auto colorValue = m_objColorBuffer[tileColumn];
+		const auto colorValue = colorValues[tileColumn];
 		*currentPixel = { GBCPalette.getColor(colorValue), colorValue, tileOverObject };
 		++currentPixel;
 		++tileColumn;
@@ -403,6 +612,7 @@ void ggb::PixelProcessingUnit::writeTileIntoBuffer(RenderingScanlineData* inOutD
 	tileColumn = 0;
 }
 
+template <bool GBCMode>
 void ggb::PixelProcessingUnit::writeCurrentWindowLineIntoBuffer()
 {
 	const auto convertScreenCoordinateToWindow = [&](int screenCoord) -> int
@@ -433,10 +643,11 @@ void ggb::PixelProcessingUnit::writeCurrentWindowLineIntoBuffer()
 	{
 		auto tileIndexAddress = (convertScreenCoordinateToWindow(data.screenXPos) / TILE_WIDTH) + yTileOffset;
 		data.tileIndexAddress = windowTileMap + tileIndexAddress;
-		writeTileIntoBuffer(&data);
+		writeTileIntoBuffer<GBCMode>(&data);
 	}
 }
 
+template <bool GBCMode>
 void ggb::PixelProcessingUnit::writeCurrentObjectLineIntoBuffer()
 {
 	constexpr int TRANSPARENT_PIXEL_VALUE = 0;
@@ -450,45 +661,37 @@ void ggb::PixelProcessingUnit::writeCurrentObjectLineIntoBuffer()
 	{
 		uint16_t tileAddress = TILE_MAP_1_ADDRESS + (*obj.tileIndex * TILE_MEMORY_SIZE);
 		const auto objScreenYPos = *obj.yPosition - SCREEN_Y_OFFSET;
-		const auto& colorPalette = GBCGetObjectColorPalette(obj);
+		const auto& colorPalette = GBCGetObjectColorPalette<GBCMode>(obj);
 		const bool backgroundOverObj = obj.drawBackgroundOverObject();
 		auto objTileLine = scanLine() - objScreenYPos;
-		uint8_t* vramBank = getVRAMBankPointer(*obj.attributes);
+		const auto vramBank = getVRAMBank<GBCMode>(*obj.attributes);
 
 		if (obj.isFlipYSet())
 			objTileLine = (getObjectHeight() - 1) - objTileLine;
 
 		// Kind of hacky for 8x16 tiles e.g. to just read the 14th tile row (even though tiles only have 8 rows)
 		// however since 8x16 objects have their tiles continuous in memory, this seems to be the cleanest way to handle them
-		getTileRowData(vramBank, tileAddress, objTileLine, m_objColorBuffer);
-		if (obj.isFlipXSet())
-			std::reverse(m_objColorBuffer.begin(), m_objColorBuffer.end());
+		const auto& colorValues = m_tileCache.getTileRow(vramBank, tileAddress, objTileLine, obj.isFlipXSet());
 
 		for (int x = *obj.xPosition - SCREEN_X_OFFSET, objX = 0; objX < TILE_WIDTH && x < GAME_WINDOW_WIDTH; ++x, ++objX)
 		{
 			if (x < 0)
 				continue;
 
-			const auto currentColorValue = m_objColorBuffer[objX];
+			const auto currentColorValue = colorValues[objX];
 			if (currentColorValue == TRANSPARENT_PIXEL_VALUE)
 				continue;
 
 			m_currentObjectRowPixelBuffer[x] = { colorPalette.getColor(currentColorValue), backgroundOverObj, true };
+			m_currentObjectRowColorValues[x] = currentColorValue;
 		}
 	}
-
-	for (int x = 0; x < GAME_WINDOW_WIDTH; x++)
-	{
-		if (m_currentObjectRowPixelBuffer[x].pixelSet)
-			m_gameFrameBuffer->setPixel(x, scanLine(), m_currentObjectRowPixelBuffer[x].rgb);
-	}
 }
 
-uint8_t* ggb::PixelProcessingUnit::getVRAMBankPointer(uint8_t attributes)
+template <bool GBCMode>
+size_t ggb::PixelProcessingUnit::getVRAMBank(uint8_t attributes) const
 {
-	if (m_GBCMode && isBitSet<3>(attributes))
-		return m_VRAMBank1Ptr;
-	return m_VRAMBank0Ptr;
+	return (GBCMode && isBitSet<3>(attributes)) ? 1 : 0;
 }
 
 uint16_t ggb::PixelProcessingUnit::getTileAddress(uint16_t tileIndexAddress, bool useSignedAddressing)
@@ -552,26 +755,28 @@ uint8_t ggb::PixelProcessingUnit::incrementScanline()
 	return *m_LCDYCoordinate;
 }
 
-ColorPalette ggb::PixelProcessingUnit::getBackgroundAndWindowColorPalette() const
+const ColorPalette& ggb::PixelProcessingUnit::getBackgroundAndWindowColorPalette() const
 {
-	return getPalette(*m_backgroundPalette);
+	return m_backgroundPaletteValue;
 }
 
+template <bool GBCMode>
 const ColorPalette& ggb::PixelProcessingUnit::GBCGetBackgroundAndWindowColorPalette(size_t index) const
 {
-	if (m_GBCMode)
+	if constexpr (GBCMode)
 		return m_GBCBackgroundColorRAM.getColorPalette(index);
 	return m_backgroundPaletteValue;
 }
 
-ColorPalette ggb::PixelProcessingUnit::GBCGetObjectColorPalette(const Object& obj) const
+template <bool GBCMode>
+const ColorPalette& ggb::PixelProcessingUnit::GBCGetObjectColorPalette(const Object& obj) const
 {
-	if (m_GBCMode)
+	if constexpr (GBCMode)
 		return m_GBCObjectColorRAM.getColorPalette(obj.getGBCPaletteIndex());
 
 	if (obj.usePalette1())
-		return getPalette(*m_objectPalette1);
-	return getPalette(*m_objectPalette0);
+		return m_objectPalette1Value;
+	return m_objectPalette0Value;
 }
 
 static void renderTileData(const std::vector<Tile>& tiles, FrameBuffer* frameBuffer, Renderer* renderer)
@@ -26,10 +26,10 @@ RGB ggb::FrameBuffer::getPixel(size_t x, size_t y) const
 	return m_buffer[calculateIndex(x, y)];
 }
 
-std::vector<RGB> ggb::FrameBuffer::getRawData() const
+const std::vector<RGB>& ggb::FrameBuffer::getRawData() const
 {
-    return m_buffer;
-};
+	return m_buffer;
+}
 
 
 void ggb::FrameBuffer::serialization(Serialization* serialization)
@@ -59,6 +59,22 @@ size_t ggb::FrameBuffer::calculateIndex(size_t x, size_t y) const
 	return y * m_width + x;
 }
 
+size_t ggb::getBytesPerPixel(PixelFormat format)
+{
+	switch (format)
+	{
+	case PixelFormat::RGB:				return sizeof(RGB);
+	case PixelFormat::RGBA8888:			return 4;
+	case PixelFormat::BGRA8888:			return 4;
+	case PixelFormat::RGB565:			return 2;
+	case PixelFormat::PALETTE_INDEX:	return 1;
+	case PixelFormat::GRAYSCALE8:		return 1;
+	default:
+		assert(!"Invalid pixel format");
+		return 0;
+	}
+}
+
 void ggb::Tile::serialization(Serialization* serialization)
 {
 	serialization->read_write(m_data);
@@ -77,18 +93,52 @@ RGB ggb::colorCorrection(ggb::RGB rgb)
 	return rgb;
 }
 
-RGB ggb::convertGBColorToRGB(GBColor color)
+RGB ggb::convertGBColorToRGB(GBColor color, bool colorCorrected)
 {
+	RGB result = {};
 	switch (color)
 	{
-	case ggb::GBColor::BLACK:		return { 0,0,0 };
-	case ggb::GBColor::DARK_GREY:	return { 85, 85, 85 };
-	case ggb::GBColor::LIGHT_GREY:	return { 170, 170, 170 };
-	case ggb::GBColor::WHITE:		return { 255, 255, 255 };
+	case ggb::GBColor::BLACK:		result = { 0,0,0 }; break;
+	case ggb::GBColor::DARK_GREY:	result = { 85, 85, 85 }; break;
+	case ggb::GBColor::LIGHT_GREY:	result = { 170, 170, 170 }; break;
+	case ggb::GBColor::WHITE:		result = { 255, 255, 255 }; break;
 	default:
 		assert(!"Invalid value entered");
 		return {};
 	}
+	return colorCorrected ? colorCorrection(result) : result;
+}
+
+static constexpr size_t GBC_COLOR_COUNT = 1 << 15;
+
+static uint8_t convertGameboyColorRGBTo24BitRGB(uint16_t number)
+{
+	static constexpr auto gbcSingleColorValueRange = 31; // 5 bits -> 2^5 = 32
+	static constexpr auto normalRGBSingleColorValueRange = 255; // 8 bits -> 2 ^8 = 256
+	return number * normalRGBSingleColorValueRange / gbcSingleColorValueRange;
+}
+
+static std::vector<RGB> createGBCColorTable(bool colorCorrected)
+{
+	static constexpr uint16_t colorBitMask = 0b11111;
+	std::vector<RGB> table(GBC_COLOR_COUNT);
+	for (size_t color = 0; color < GBC_COLOR_COUNT; ++color)
+	{
+		RGB& rgb = table[color];
+		rgb.r = convertGameboyColorRGBTo24BitRGB(color & colorBitMask);
+		rgb.g = convertGameboyColorRGBTo24BitRGB((color >> 5) & colorBitMask);
+		rgb.b = convertGameboyColorRGBTo24BitRGB((color >> 10) & colorBitMask);
+		if (colorCorrected)
+			rgb = colorCorrection(rgb);
+	}
+	return table;
+}
+
+const RGB& ggb::convertGBCColorToRGB(uint16_t color, bool colorCorrected)
+{
+	static const auto table = createGBCColorTable(false);
+	static const auto correctedTable = createGBCColorTable(true);
+	return (colorCorrected ? correctedTable : table)[color & (GBC_COLOR_COUNT - 1)];
 }
 
 void ggb::overWriteTileData(BUS* bus, uint16_t tileIndex, const ColorPalette& palette, Tile* outTile, std::vector<uint8_t>& bufVec)
@@ -105,30 +155,36 @@ void ggb::overWriteTileData(BUS* bus, uint16_t tileIndex, const ColorPalette& pa
 	//}
 }
 
-template <int number>
-static inline constexpr void fillData(uint8_t low, uint8_t high, std::vector<uint8_t>& outVec) 
+// Spreads the 8 bits of a tile data byte into the 8 bytes of the result, the byte at bit 8 * n is the n-th pixel from the left
+static constexpr std::array<uint64_t, 256> createTileRowTable(bool flipX)
 {
-	auto lsb = isBitSet<number>(low);
-	auto msb = isBitSet<number>(high);
-	auto num = getNumberFromBits(lsb, msb);
-	outVec[7 - number] = num;
+	std::array<uint64_t, 256> table = {};
+	for (int value = 0; value < 256; ++value)
+	{
+		for (int pixel = 0; pixel < TILE_WIDTH; ++pixel)
+		{
+			const int bit = flipX ? pixel : (TILE_WIDTH - 1) - pixel;
+			if ((value >> bit) & 1)
+				table[value] |= uint64_t{ 1 } << (pixel * 8);
+		}
+	}
+	return table;
 }
 
-void ggb::getTileRowData(const uint8_t* vramPtr, uint16_t tileAddress, uint8_t tileRow, std::vector<uint8_t>& outVec)
+static constexpr auto TILE_ROW_TABLE = createTileRowTable(false);
+static constexpr auto FLIPPED_TILE_ROW_TABLE = createTileRowTable(true);
+
+TileRowData ggb::getTileRowData(const uint8_t* vramPtr, uint16_t tileAddress, uint8_t tileRow, bool flipX)
 {
-	assert(outVec.size() >= 8);
-	auto vramIndex = getVRAMIndexFromAddress(tileAddress + (tileRow * 2));
-	auto low = vramPtr[vramIndex];
-	auto high = vramPtr[vramIndex + 1];
+	const auto vramIndex = getVRAMIndexFromAddress(tileAddress + (tileRow * 2));
+	const auto& table = flipX ? FLIPPED_TILE_ROW_TABLE : TILE_ROW_TABLE;
+	// The low byte holds bit 0 and the high byte bit 1 of every color value
+	const uint64_t colorValues = table[vramPtr[vramIndex]] | (table[vramPtr[vramIndex + 1]] << 1);
 
-	fillData<7>(low, high, outVec);
-	fillData<6>(low, high, outVec);
-	fillData<5>(low, high, outVec);
-	fillData<4>(low, high, outVec);
-	fillData<3>(low, high, outVec);
-	fillData<2>(low, high, outVec);
-	fillData<1>(low, high, outVec);
-	fillData<0>(low, high, outVec);
+	TileRowData result;
+	for (size_t i = 0; i < result.size(); ++i)
+		result[i] = static_cast<uint8_t>(colorValues >> (i * 8));
+	return result;
 }
 
 const RGB& ggb::ColorPalette::getColor(size_t index) const
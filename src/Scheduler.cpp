@@ -0,0 +1,132 @@
+#include "Scheduler.hpp"
+
+#include <algorithm>
+
+#include "Audio/AudioProcessingUnit.hpp"
+#include "Constants.hpp"
+#include "PixelProcessingUnit.hpp"
+#include "Timer.hpp"
+
+using Component = ggb::Scheduler::Component;
+
+// At most one millisecond between two synchronizations to keep the clock synchronization responsive
+static constexpr int MAX_CYCLES_UNTIL_SYNCHRONIZATION = ggb::CPU_BASE_CLOCK / 1000;
+
+void ggb::Scheduler::reset()
+{
+	m_currentCycle = 0;
+	m_nextDeadline = 0;
+	m_deadlines = {};
+	m_lastSynchronization = {};
+}
+
+void ggb::Scheduler::setComponents(PixelProcessingUnit* ppu, Timer* timer, AudioProcessingUnit* audio)
+{
+	m_ppu = ppu;
+	m_timer = timer;
+	m_audio = audio;
+}
+
+void ggb::Scheduler::setMode(bool doubleSpeed, bool audioEnabled)
+{
+	if (doubleSpeed == m_doubleSpeed && audioEnabled == m_audioEnabled)
+		return;
+
+	// The cycles elapsed so far still count with the previous mode
+	synchronizeAll();
+	m_doubleSpeed = doubleSpeed;
+	m_audioEnabled = audioEnabled;
+	reschedule(Component::PPU);
+	reschedule(Component::TIMER);
+	reschedule(Component::AUDIO);
+}
+
+void ggb::Scheduler::synchronize(Component component)
+{
+	auto& lastSynchronization = m_lastSynchronization[static_cast<size_t>(component)];
+	const auto elapsedCycles = static_cast<int>(m_currentCycle - lastSynchronization);
+	lastSynchronization = m_currentCycle;
+	if (elapsedCycles != 0)
+		stepComponent(component, elapsedCycles);
+	reschedule(component);
+}
+
+void ggb::Scheduler::synchronizeAll()
+{
+	// Same order as stepping the components after every instruction
+	synchronize(Component::PPU);
+	synchronize(Component::TIMER);
+	synchronize(Component::AUDIO);
+}
+
+void ggb::Scheduler::synchronizeDueComponents()
+{
+	for (size_t i = 0; i < COMPONENT_COUNT; ++i)
+	{
+		if (m_deadlines[i] <= m_currentCycle)
+			synchronize(static_cast<Component>(i));
+	}
+}
+
+void ggb::Scheduler::reschedule(Component component)
+{
+	const auto index = static_cast<size_t>(component);
+	m_deadlines[index] = m_lastSynchronization[index] + cyclesUntilNextEvent(component);
+	updateNextDeadline();
+}
+
+void ggb::Scheduler::requestSynchronization()
+{
+	m_nextDeadline = m_currentCycle;
+}
+
+void ggb::Scheduler::stepComponent(Component component, int cycles)
+{
+	const int gbcDoubleSpeedAdjustedCycles = m_doubleSpeed ? cycles / 2 : cycles;
+	switch (component)
+	{
+	case Component::PPU:
+		m_ppu->step(gbcDoubleSpeedAdjustedCycles);
+		break;
+	case Component::TIMER:
+		m_timer->step(cycles);
+		break;
+	case Component::AUDIO:
+		if (m_audioEnabled)
+			m_audio->step(gbcDoubleSpeedAdjustedCycles);
+		break;
+	default:
+		break;
+	}
+}
+
+int ggb::Scheduler::cyclesUntilNextEvent(Component component) const
+{
+	int cycles = NO_PENDING_EVENT;
+	switch (component)
+	{
+	case Component::PPU:
+		cycles = m_ppu->cyclesUntilNextEvent();
+		break;
+	case Component::TIMER:
+		cycles = m_timer->cyclesUntilNextEvent();
+		break;
+	case Component::AUDIO:
+		if (m_audioEnabled)
+			cycles = m_audio->cyclesUntilNextEvent();
+		break;
+	default:
+		break;
+	}
+
+	// An event that is already due happens after the next instruction
+	cycles = std::clamp(cycles, 0, MAX_CYCLES_UNTIL_SYNCHRONIZATION);
+	if (m_doubleSpeed && component != Component::TIMER)
+		cycles *= 2;
+	return cycles;
+}
+
+void ggb::Scheduler::updateNextDeadline()
+{
+	m_nextDeadline = *std::min_element(m_deadlines.begin(), m_deadlines.end());
+}
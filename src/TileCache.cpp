@@ -0,0 +1,40 @@
+#include "TileCache.hpp"
+
+#include <algorithm>
+
+ggb::TileCache::TileCache()
+{
+	invalidateAll();
+}
+
+void ggb::TileCache::setVRAM(const uint8_t* bank0, const uint8_t* bank1)
+{
+	m_vram = { bank0, bank1 };
+	invalidateAll();
+}
+
+void ggb::TileCache::invalidate(size_t bank, uint16_t vramIndex, uint16_t sizeInBytes)
+{
+	const size_t firstTile = vramIndex / TILE_MEMORY_SIZE;
+	const size_t lastTile = std::min<size_t>((vramIndex + sizeInBytes - 1) / TILE_MEMORY_SIZE, VRAM_TILE_COUNT - 1);
+	for (size_t tile = firstTile; tile <= lastTile; ++tile)
+		m_dirty[bank][tile] = true;
+}
+
+void ggb::TileCache::invalidateAll()
+{
+	for (auto& dirty : m_dirty)
+		dirty.fill(true);
+}
+
+void ggb::TileCache::decodeTile(size_t bank, size_t tileIndex)
+{
+	const uint16_t tileAddress = static_cast<uint16_t>(TILE_MAP_1_ADDRESS + (tileIndex * TILE_MEMORY_SIZE));
+	auto& tile = m_tiles[bank][tileIndex];
+	for (uint8_t row = 0; row < TILE_HEIGHT; ++row)
+	{
+		tile.rows[row] = getTileRowData(m_vram[bank], tileAddress, row, false);
+		tile.flippedRows[row] = getTileRowData(m_vram[bank], tileAddress, row, true);
+	}
+	m_dirty[bank][tileIndex] = false;
+}
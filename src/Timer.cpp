@@ -44,19 +44,35 @@ void ggb::Timer::step(int elapsedCycles)
 	if (!m_enabled)
 		return;
 
+	// The timer is only stepped on events and register accesses, compute all increments at once
 	m_counterForTimerCounter += elapsedCycles;
-	while (m_counterForTimerCounter >= m_timerControlValue)
+	uint32_t increments = m_counterForTimerCounter / m_timerControlValue;
+	m_counterForTimerCounter %= m_timerControlValue;
+	while (increments > 0)
 	{
-		m_counterForTimerCounter -= m_timerControlValue;
-		++(*m_timerCounter);
-		if (*m_timerCounter == 0) 
+		const uint32_t incrementsUntilOverflow = 0x100 - *m_timerCounter;
+		if (increments < incrementsUntilOverflow)
 		{
-			*m_timerCounter = *m_timerModulo;
-			m_bus->requestInterrupt(INTERRUPT_TIMER_BIT);
+			*m_timerCounter += static_cast<uint8_t>(increments);
+			return;
 		}
+
+		increments -= incrementsUntilOverflow;
+		*m_timerCounter = *m_timerModulo;
+		m_bus->requestInterrupt(INTERRUPT_TIMER_BIT);
 	}
 }
 
+int ggb::Timer::cyclesUntilNextEvent() const
+{
+	if (!m_enabled)
+		return NO_PENDING_EVENT;
+
+	// TIMA overflows and requests the timer interrupt after 256 - TIMA increments
+	const int incrementsUntilOverflow = 0x100 - *m_timerCounter;
+	return incrementsUntilOverflow * static_cast<int>(m_timerControlValue) - static_cast<int>(m_counterForTimerCounter);
+}
+
 void ggb::Timer::resetDividerRegister()
 {
 	*m_dividerRegister = 0x00;
@@ -81,9 +97,6 @@ void ggb::Timer::updateAfterWrite()
 inline void ggb::Timer::updateTimerDivider(int elapsedCycles)
 {
 	m_dividerCounter += elapsedCycles;
-	if (m_dividerCounter >= TIMER_DIVIDER_REGISTER_INCREMENT_COUNT)
-	{
-		++(*m_dividerRegister);
-		m_dividerCounter -= TIMER_DIVIDER_REGISTER_INCREMENT_COUNT;
-	}
+	*m_dividerRegister += static_cast<uint8_t>(m_dividerCounter / TIMER_DIVIDER_REGISTER_INCREMENT_COUNT); // DIV wraps around
+	m_dividerCounter %= TIMER_DIVIDER_REGISTER_INCREMENT_COUNT;
 }